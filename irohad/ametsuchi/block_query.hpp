@@ -28,16 +28,16 @@ namespace iroha {
         std::string message;
       };
 
-      using BlockResult =
-          expected::Result<std::unique_ptr<shared_model::interface::Block>,
-                           GetBlockError>;
+      using BlockResult = expected::Result<
+          std::shared_ptr<const shared_model::interface::Block>,
+          GetBlockError>;
 
       virtual ~BlockQuery() = default;
 
       /**
        * Retrieve block with given height from block storage
        * @param height - height of a block to retrieve
-       * @return block with given height
+       * @return block with given height, shared with the block storage
        */
       virtual BlockResult getBlock(
           shared_model::interface::types::HeightType height) = 0;
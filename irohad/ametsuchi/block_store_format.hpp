@@ -0,0 +1,25 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_STORE_FORMAT_HPP
+#define IROHA_BLOCK_STORE_FORMAT_HPP
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Layouts of block store on file system
+     */
+    enum class BlockStoreFormat {
+      /// a separate file for each block
+      kFlatFile,
+      /// blocks appended to large segment files
+      kSegmentedLog
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_STORE_FORMAT_HPP
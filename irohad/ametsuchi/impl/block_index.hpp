@@ -8,6 +8,8 @@
 
 #include <memory>
 
+#include "common/result.hpp"
+
 namespace shared_model {
   namespace interface {
     class Block;
@@ -28,6 +30,23 @@ namespace iroha {
        * @param block to be indexed
        */
       virtual void index(const shared_model::interface::Block &) = 0;
+
+      /**
+       * Collect indexes for block without writing them. Does not access the
+       * database, so it could run concurrently with other users of the
+       * session
+       * @param block to be indexed
+       */
+      virtual void prepare(const shared_model::interface::Block &) = 0;
+
+      /**
+       * Write indexes collected by prepare
+       * @return Void Value on success, string Error on failure.
+       */
+      virtual iroha::expected::Result<void, std::string> flush() = 0;
+
+      /// Drop indexes collected by prepare
+      virtual void discard() = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_prefetcher.hpp"
+
+#include <algorithm>
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HeightType;
+
+BlockPrefetcher::BlockPrefetcher(BlockQuery &block_query,
+                                 HeightType first_height,
+                                 HeightType last_height,
+                                 size_t workers,
+                                 size_t queue_size)
+    : block_query_(block_query),
+      last_height_(last_height),
+      queue_size_(std::max<size_t>(queue_size, 1)),
+      next_taken_(first_height),
+      next_read_(first_height) {
+  if (workers == 0) {
+    workers = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  if (last_height >= first_height) {
+    workers = std::min<size_t>(workers, last_height - first_height + 1);
+    for (size_t i = 0; i < workers; ++i) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+}
+
+BlockPrefetcher::~BlockPrefetcher() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  block_taken_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+BlockQuery::BlockResult BlockPrefetcher::next() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  block_read_.wait(lock, [this] { return blocks_.count(next_taken_) != 0; });
+  auto it = blocks_.find(next_taken_);
+  auto result = std::move(it->second);
+  blocks_.erase(it);
+  ++next_taken_;
+  lock.unlock();
+  block_taken_.notify_all();
+  return result;
+}
+
+void BlockPrefetcher::work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    block_taken_.wait(lock, [this] {
+      return stopped_ or next_read_ < next_taken_ + queue_size_;
+    });
+    if (stopped_ or next_read_ > last_height_) {
+      return;
+    }
+    auto height = next_read_++;
+
+    lock.unlock();
+    auto block = block_query_.getBlock(height);
+    lock.lock();
+
+    blocks_.emplace(height, std::move(block));
+    block_read_.notify_all();
+  }
+}
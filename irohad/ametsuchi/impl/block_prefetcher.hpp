@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_PREFETCHER_HPP
+#define IROHA_BLOCK_PREFETCHER_HPP
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ametsuchi/block_query.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Reads a range of blocks ahead of their consumer on several threads.
+     * Fetching, deserialization and hashing of blocks do not depend on WSV,
+     * so they run in parallel, while blocks are handed out strictly in height
+     * order to a single thread which applies them. At most queue_size blocks
+     * are read ahead, which bounds memory usage when the consumer is slower.
+     */
+    class BlockPrefetcher {
+     public:
+      /// Default number of blocks read ahead of the consumer
+      static const size_t kDefaultQueueSize = 64;
+
+      /**
+       * Start reading blocks
+       * @param block_query - source of blocks, getBlock is called from
+       * several threads concurrently
+       * @param first_height - height of the first block to read
+       * @param last_height - height of the last block to read
+       * @param workers - number of reading threads, 0 for the number of
+       * hardware threads
+       * @param queue_size - maximal number of blocks read ahead
+       */
+      BlockPrefetcher(BlockQuery &block_query,
+                      shared_model::interface::types::HeightType first_height,
+                      shared_model::interface::types::HeightType last_height,
+                      size_t workers = 0,
+                      size_t queue_size = kDefaultQueueSize);
+
+      BlockPrefetcher(const BlockPrefetcher &) = delete;
+      BlockPrefetcher &operator=(const BlockPrefetcher &) = delete;
+
+      /// Stops reading and waits for the threads
+      ~BlockPrefetcher();
+
+      /**
+       * Wait for the next block in height order. Must not be called after
+       * the last block was returned
+       * @return the block or error of its reading
+       */
+      BlockQuery::BlockResult next();
+
+     private:
+      void work();
+
+      BlockQuery &block_query_;
+      const shared_model::interface::types::HeightType last_height_;
+      const size_t queue_size_;
+
+      std::mutex mutex_;
+      /// notified when a block is read
+      std::condition_variable block_read_;
+      /// notified when a block is taken by the consumer
+      std::condition_variable block_taken_;
+      /// height of the next block to be taken by the consumer
+      shared_model::interface::types::HeightType next_taken_;
+      /// height of the next block to be read by a worker
+      shared_model::interface::types::HeightType next_read_;
+      std::map<shared_model::interface::types::HeightType,
+               BlockQuery::BlockResult>
+          blocks_;
+      bool stopped_ = false;
+
+      std::vector<std::thread> workers_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_PREFETCHER_HPP
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/connection_pool_monitor.hpp"
+
+#include <algorithm>
+
+#include <boost/format.hpp>
+
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  /// number of leases between two reports of the pool statistics
+  constexpr uint64_t kReportPeriod = 1000;
+}  // namespace
+
+ConnectionPoolMonitor::Lease::Lease(ConnectionPoolMonitor &monitor)
+    : monitor_(monitor) {}
+
+ConnectionPoolMonitor::Lease::~Lease() {
+  monitor_.release();
+}
+
+ConnectionPoolMonitor::ConnectionPoolMonitor(
+    size_t size, std::chrono::milliseconds lease_timeout, logger::LoggerPtr log)
+    : lease_timeout_(lease_timeout), log_(std::move(log)) {
+  metrics_.size = size;
+}
+
+std::unique_ptr<ConnectionPoolMonitor::Lease> ConnectionPoolMonitor::acquire() {
+  auto start = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock(mutex_);
+  bool acquired = released_.wait_for(lock, lease_timeout_, [this] {
+    return metrics_.in_use < metrics_.size;
+  });
+  auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+  metrics_.total_wait += wait;
+  metrics_.max_wait = std::max(metrics_.max_wait, wait);
+
+  if (not acquired) {
+    ++metrics_.timeouts;
+    log_->warn("No connection was freed in {} ms. {}",
+               lease_timeout_.count(),
+               describe());
+    return nullptr;
+  }
+
+  ++metrics_.in_use;
+  ++metrics_.leases;
+  if (wait > lease_timeout_ / 2) {
+    // the pool is close to rejecting queries
+    log_->warn("Leased connection after {} us. {}", wait.count(), describe());
+  } else if (metrics_.leases % kReportPeriod == 0) {
+    log_->info("{}", describe());
+  } else {
+    log_->trace("Leased connection after {} us, {} in use",
+                wait.count(),
+                metrics_.in_use);
+  }
+  return std::make_unique<Lease>(*this);
+}
+
+ConnectionPoolMonitor::Metrics ConnectionPoolMonitor::metrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+std::string ConnectionPoolMonitor::describe() const {
+  auto attempts = metrics_.leases + metrics_.timeouts;
+  return (boost::format("%d of %d connections in use, %d leases, %d timeouts, "
+                        "average wait %d us, max wait %d us")
+          % metrics_.in_use % metrics_.size % metrics_.leases
+          % metrics_.timeouts
+          % (attempts == 0 ? 0 : metrics_.total_wait.count() / attempts)
+          % metrics_.max_wait.count())
+      .str();
+}
+
+void ConnectionPoolMonitor::release() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --metrics_.in_use;
+  }
+  released_.notify_one();
+}
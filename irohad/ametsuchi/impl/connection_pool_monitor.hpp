@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CONNECTION_POOL_MONITOR_HPP
+#define IROHA_CONNECTION_POOL_MONITOR_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Limits concurrent leases of a connection pool and collects their
+     * metrics. The metrics are logged along with slow and failed leases, and
+     * periodically after a number of leases. A session must be taken from the
+     * pool only while a lease is held, so taking it never blocks, and callers
+     * wait here with a timeout instead of waiting for the pool indefinitely.
+     */
+    class ConnectionPoolMonitor {
+     public:
+      /// Usage statistics of the pool
+      struct Metrics {
+        /// number of connections in the pool
+        size_t size = 0;
+        /// number of currently leased connections
+        size_t in_use = 0;
+        /// number of successful leases
+        uint64_t leases = 0;
+        /// number of leases failed because of the timeout
+        uint64_t timeouts = 0;
+        /// total time spent waiting for leases, including failed ones
+        std::chrono::microseconds total_wait{0};
+        /// longest wait for a lease
+        std::chrono::microseconds max_wait{0};
+      };
+
+      /// Right to use one pooled connection, given back on destruction
+      class Lease {
+       public:
+        explicit Lease(ConnectionPoolMonitor &monitor);
+
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        ~Lease();
+
+       private:
+        ConnectionPoolMonitor &monitor_;
+      };
+
+      /**
+       * @param size - number of connections in the pool
+       * @param lease_timeout - maximal wait for a free connection
+       * @param log - logger
+       */
+      ConnectionPoolMonitor(size_t size,
+                            std::chrono::milliseconds lease_timeout,
+                            logger::LoggerPtr log);
+
+      /**
+       * Wait for a free connection
+       * @return lease of the connection or nullptr, if no connection was
+       * freed within the timeout
+       */
+      std::unique_ptr<Lease> acquire();
+
+      /// @return current statistics
+      Metrics metrics() const;
+
+     private:
+      void release();
+
+      /// @return statistics in a readable form, must be called under mutex_
+      std::string describe() const;
+
+      const std::chrono::milliseconds lease_timeout_;
+
+      mutable std::mutex mutex_;
+      std::condition_variable released_;
+      Metrics metrics_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CONNECTION_POOL_MONITOR_HPP
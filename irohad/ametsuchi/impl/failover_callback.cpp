@@ -18,11 +18,13 @@ FailoverCallback::FailoverCallback(
     InitFunctionType init,
     std::string connection_options,
     std::unique_ptr<ReconnectionStrategy> reconnection_strategy,
+    std::atomic<size_t> &reconnections,
     logger::LoggerPtr log)
     : connection_(connection),
       init_session_(std::move(init)),
       connection_options_(std::move(connection_options)),
       reconnection_strategy_(std::move(reconnection_strategy)),
+      reconnections_(reconnections),
       log_(std::move(log)) {}
 
 void FailoverCallback::started() {
@@ -40,6 +42,10 @@ void FailoverCallback::failed(bool &should_reconnect, std::string &) {
       "failed to connect to the database. The system will try to "
       "reconnect");
   auto is_reconnected = reconnectionLoop();
+  if (is_reconnected) {
+    // the new connection has none of the statements prepared on the old one
+    ++reconnections_;
+  }
   log_->info("re-established: {}", is_reconnected);
 }
 
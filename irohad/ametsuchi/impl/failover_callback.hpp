@@ -6,6 +6,7 @@
 #ifndef IROHA_FAILOVER_CALLBACK_HPP
 #define IROHA_FAILOVER_CALLBACK_HPP
 
+#include <atomic>
 #include <memory>
 
 #include <soci/soci.h>
@@ -30,6 +31,7 @@ namespace iroha {
           InitFunctionType init,
           std::string connection_options,
           std::unique_ptr<ReconnectionStrategy> reconnection_strategy,
+          std::atomic<size_t> &reconnections,
           logger::LoggerPtr log);
 
       FailoverCallback(const FailoverCallback &) = delete;
@@ -50,6 +52,9 @@ namespace iroha {
       InitFunctionType init_session_;
       const std::string connection_options_;
       std::unique_ptr<ReconnectionStrategy> reconnection_strategy_;
+      /// counter of successful reconnections, shared by the callbacks of a
+      /// holder
+      std::atomic<size_t> &reconnections_;
       logger::LoggerPtr log_;
     };
   }  // namespace ametsuchi
@@ -18,6 +18,11 @@ FailoverCallback &FailoverCallbackHolder::makeFailoverCallback(
                                          std::move(init),
                                          std::move(connection_options),
                                          std::move(reconnection_strategy),
+                                         reconnections_,
                                          std::move(log)));
   return *callbacks_.back();
 }
+
+size_t FailoverCallbackHolder::reconnections() const {
+  return reconnections_.load();
+}
@@ -6,6 +6,8 @@
 #ifndef IROHA_FAILOVER_CALLBACK_HOLDER_HPP
 #define IROHA_FAILOVER_CALLBACK_HOLDER_HPP
 
+#include <atomic>
+
 #include "ametsuchi/impl/failover_callback.hpp"
 
 namespace iroha {
@@ -19,8 +21,16 @@ namespace iroha {
           std::unique_ptr<ReconnectionStrategy> reconnection_strategy,
           logger::LoggerPtr log);
 
+      /**
+       * @return number of successful reconnections of the sessions which use
+       * callbacks of this holder. Changes whenever state bound to a
+       * connection, like prepared statements, is lost
+       */
+      size_t reconnections() const;
+
      private:
       std::vector<std::unique_ptr<FailoverCallback>> callbacks_;
+      std::atomic<size_t> reconnections_{0};
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -119,6 +119,17 @@ Identifier FlatFile::last_id() const {
   return (available_blocks_.empty()) ? 0 : *available_blocks_.rbegin();
 }
 
+size_t FlatFile::size() const {
+  return available_blocks_.size();
+}
+
+void FlatFile::forEachId(
+    const std::function<void(Identifier)> &function) const {
+  for (auto id : available_blocks_) {
+    function(id);
+  }
+}
+
 void FlatFile::dropAll() {
   iroha::remove_dir_contents(dump_dir_, log_);
   available_blocks_.clear();
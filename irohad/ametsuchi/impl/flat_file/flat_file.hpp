@@ -71,6 +71,11 @@ namespace iroha {
 
       Identifier last_id() const override;
 
+      size_t size() const override;
+
+      void forEachId(
+          const std::function<void(Identifier)> &function) const override;
+
       void dropAll() override;
 
       /**
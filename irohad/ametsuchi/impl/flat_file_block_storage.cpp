@@ -14,7 +14,7 @@
 using namespace iroha::ametsuchi;
 
 FlatFileBlockStorage::FlatFileBlockStorage(
-    std::unique_ptr<FlatFile> flat_file,
+    std::unique_ptr<KeyValueStorage> flat_file,
     std::shared_ptr<shared_model::interface::BlockJsonConverter> json_converter,
     logger::LoggerPtr log)
     : flat_file_storage_(std::move(flat_file)),
@@ -58,7 +58,7 @@ FlatFileBlockStorage::fetch(
 }
 
 size_t FlatFileBlockStorage::size() const {
-  return flat_file_storage_->blockIdentifiers().size();
+  return flat_file_storage_->size();
 }
 
 void FlatFileBlockStorage::clear() {
@@ -67,9 +67,9 @@ void FlatFileBlockStorage::clear() {
 
 void FlatFileBlockStorage::forEach(
     iroha::ametsuchi::BlockStorage::FunctionType function) const {
-  for (auto block_id : flat_file_storage_->blockIdentifiers()) {
-    auto block = fetch(block_id);
+  flat_file_storage_->forEachId([this, &function](auto block_id) {
+    auto block = this->fetch(block_id);
     BOOST_ASSERT(block);
     function(*block);
-  }
+  });
 }
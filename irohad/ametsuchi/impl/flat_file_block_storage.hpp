@@ -8,7 +8,7 @@
 
 #include "ametsuchi/block_storage.hpp"
 
-#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/key_value_storage.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -17,7 +17,7 @@ namespace iroha {
     class FlatFileBlockStorage : public BlockStorage {
      public:
       FlatFileBlockStorage(
-          std::unique_ptr<FlatFile> flat_file,
+          std::unique_ptr<KeyValueStorage> flat_file,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
               json_converter,
           logger::LoggerPtr log);
@@ -35,7 +35,7 @@ namespace iroha {
       void forEach(FunctionType function) const override;
 
      private:
-      std::unique_ptr<FlatFile> flat_file_storage_;
+      std::unique_ptr<KeyValueStorage> flat_file_storage_;
       std::shared_ptr<shared_model::interface::BlockJsonConverter>
           json_converter_;
       logger::LoggerPtr log_;
@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/flat_file_block_storage_factory.hpp"
 
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 
 using namespace iroha::ametsuchi;
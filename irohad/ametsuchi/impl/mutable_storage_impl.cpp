@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 
+#include <future>
+
 #include <boost/variant/apply_visitor.hpp>
 #include <rxcpp/operators/rx-all.hpp>
 #include "ametsuchi/command_executor.hpp"
@@ -56,14 +58,38 @@ namespace iroha {
                  block->height(),
                  block->hash().hex());
 
+      // drop indexes left by a previous block which failed with an exception
+      block_index_->discard();
+      // indexes are built on a worker thread while transactions are executed
+      // on the session, and are written after the block is applied
+      auto index_prepared = std::async(std::launch::async, [this, &block] {
+        block_index_->prepare(*block);
+      });
+
       auto block_applied =
           (not ledger_state_ or predicate(block, *ledger_state_.value()))
           and std::all_of(block->transactions().begin(),
                           block->transactions().end(),
                           execute_transaction);
+      auto index_ready = true;
+      try {
+        index_prepared.get();
+      } catch (const std::exception &e) {
+        log_->error("Failed to index block {}: {}", block->height(), e.what());
+        index_ready = false;
+      }
+      if (not block_applied or not index_ready) {
+        // never write a partially prepared index
+        block_index_->discard();
+      }
       if (block_applied) {
         block_storage_->insert(block);
-        block_index_->index(*block);
+        if (index_ready) {
+          if (auto e =
+                  expected::resultToOptionalError(block_index_->flush())) {
+            log_->error("Failed to index block {}: {}", block->height(), *e);
+          }
+        }
 
         auto opt_ledger_peers = peer_query_->getLedgerPeers();
         if (not opt_ledger_peers) {
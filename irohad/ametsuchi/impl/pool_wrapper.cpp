@@ -6,6 +6,7 @@
 #include "ametsuchi/impl/pool_wrapper.hpp"
 
 #include <soci/soci.h>
+#include "ametsuchi/impl/connection_pool_monitor.hpp"
 #include "ametsuchi/impl/failover_callback_holder.hpp"
 
 using namespace iroha::ametsuchi;
@@ -13,7 +14,17 @@ using namespace iroha::ametsuchi;
 PoolWrapper::PoolWrapper(
     std::shared_ptr<soci::connection_pool> connection_pool,
     std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-    bool enable_prepared_transactions)
+    bool enable_prepared_transactions,
+    std::shared_ptr<soci::connection_pool> query_connection_pool,
+    size_t query_pool_size,
+    std::shared_ptr<ConnectionPoolMonitor> query_pool_monitor,
+    std::shared_ptr<soci::connection_pool> primary_query_connection_pool,
+    std::shared_ptr<ConnectionPoolMonitor> primary_query_pool_monitor)
     : connection_pool_(std::move(connection_pool)),
       failover_callback_holder_(std::move(failover_callback_holder)),
-      enable_prepared_transactions_(enable_prepared_transactions) {}
+      enable_prepared_transactions_(enable_prepared_transactions),
+      query_connection_pool_(std::move(query_connection_pool)),
+      query_pool_size_(query_pool_size),
+      query_pool_monitor_(std::move(query_pool_monitor)),
+      primary_query_connection_pool_(std::move(primary_query_connection_pool)),
+      primary_query_pool_monitor_(std::move(primary_query_pool_monitor)) {}
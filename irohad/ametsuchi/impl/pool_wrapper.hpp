@@ -6,6 +6,7 @@
 #ifndef IROHA_POOL_WRAPPER_HPP
 #define IROHA_POOL_WRAPPER_HPP
 
+#include <chrono>
 #include <memory>
 
 namespace soci {
@@ -14,17 +15,48 @@ namespace soci {
 
 namespace iroha {
   namespace ametsuchi {
+    class ConnectionPoolMonitor;
     class FailoverCallbackHolder;
 
+    /// Options of the separate pool which serves client queries
+    struct QueryPoolOptions {
+      /// number of connections
+      size_t size;
+      /// maximal wait for a free connection before the query is rejected
+      std::chrono::milliseconds lease_timeout;
+    };
+
     struct PoolWrapper {
       PoolWrapper(
           std::shared_ptr<soci::connection_pool> connection_pool,
           std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-          bool enable_prepared_transactions);
+          bool enable_prepared_transactions,
+          std::shared_ptr<soci::connection_pool> query_connection_pool =
+              nullptr,
+          size_t query_pool_size = 0,
+          std::shared_ptr<ConnectionPoolMonitor> query_pool_monitor = nullptr,
+          std::shared_ptr<soci::connection_pool>
+              primary_query_connection_pool = nullptr,
+          std::shared_ptr<ConnectionPoolMonitor> primary_query_pool_monitor =
+              nullptr);
 
       std::shared_ptr<soci::connection_pool> connection_pool_;
       std::unique_ptr<FailoverCallbackHolder> failover_callback_holder_;
       bool enable_prepared_transactions_;
+
+      /// pool of client queries, so that they do not compete for connections
+      /// with block commit. Null if queries use connection_pool_
+      std::shared_ptr<soci::connection_pool> query_connection_pool_;
+      size_t query_pool_size_;
+      /// limits leases of query_connection_pool_ and collects their metrics
+      std::shared_ptr<ConnectionPoolMonitor> query_pool_monitor_;
+      /// pool of client queries connected to the working database, which
+      /// serves them while the replica lags behind. Null if
+      /// query_connection_pool_ is not connected to a read replica
+      std::shared_ptr<soci::connection_pool> primary_query_connection_pool_;
+      /// limits leases of primary_query_connection_pool_, which has
+      /// query_pool_size_ connections as well
+      std::shared_ptr<ConnectionPoolMonitor> primary_query_pool_monitor_;
     };
 
   }  // namespace ametsuchi
@@ -65,6 +65,14 @@ PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
     : indexer_(std::move(indexer)), log_(std::move(log)) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
+  prepare(block);
+  if (auto e = resultToOptionalError(flush())) {
+    log_->error(e.value());
+  }
+}
+
+void PostgresBlockIndex::prepare(
+    const shared_model::interface::Block &block) {
   auto height = block.height();
   for (const auto &tx : block.transactions() | boost::adaptors::indexed(0)) {
     const auto &creator_id = tx.value().creatorAccountId();
@@ -79,8 +87,13 @@ void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
   for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
     indexer_->rejectedTxHash(rejected_tx_hash);
   }
+  indexer_->topBlock(height, block.hash());
+}
 
-  if (auto e = resultToOptionalError(indexer_->flush())) {
-    log_->error(e.value());
-  }
+iroha::expected::Result<void, std::string> PostgresBlockIndex::flush() {
+  return indexer_->flush();
+}
+
+void PostgresBlockIndex::discard() {
+  indexer_->discard();
 }
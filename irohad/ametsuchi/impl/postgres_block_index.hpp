@@ -35,6 +35,12 @@ namespace iroha {
       /// Index a block.
       void index(const shared_model::interface::Block &block) override;
 
+      void prepare(const shared_model::interface::Block &block) override;
+
+      iroha::expected::Result<void, std::string> flush() override;
+
+      void discard() override;
+
      private:
       /// Index a transaction.
       void makeAccountAssetIndex(
@@ -8,7 +8,6 @@
 #include <boost/format.hpp>
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "common/byteutils.hpp"
-#include "common/cloneable.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -35,7 +34,7 @@ namespace iroha {
         return expected::makeError(
             GetBlockError{GetBlockError::Code::kNoBlock, error.str()});
       }
-      return clone(**block);
+      return *std::move(block);
     }
 
     shared_model::interface::types::HeightType
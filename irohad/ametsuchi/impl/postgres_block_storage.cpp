@@ -5,6 +5,7 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
+#include <soci/postgresql/soci-postgresql.h>
 #include "common/hexutils.hpp"
 #include "logger/logger.hpp"
 
@@ -12,52 +13,143 @@ using namespace iroha::ametsuchi;
 
 using shared_model::interface::types::HeightType;
 
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  /// Get libpq connection which is used by soci session
+  PGconn *getConnection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  /// Text and binary format codes of libpq parameters and results
+  constexpr int kTextFormat = 0;
+  constexpr int kBinaryFormat = 1;
+}  // namespace
+
 PostgresBlockStorage::PostgresBlockStorage(
     std::shared_ptr<PoolWrapper> pool_wrapper,
     std::shared_ptr<BlockTransportFactory> block_factory,
     std::string table,
+    BlockDataFormat data_format,
     logger::LoggerPtr log)
     : pool_wrapper_(std::move(pool_wrapper)),
       block_factory_(std::move(block_factory)),
       table_(std::move(table)),
-      log_(std::move(log)) {}
+      data_format_(data_format),
+      log_(std::move(log)),
+      height_range_(queryBlockHeightsRange()) {}
 
 bool PostgresBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
   auto inserted_height = block->height();
 
-  auto opt_range = getBlockHeightsRange();
-  if (opt_range and inserted_height != opt_range->max + 1) {
+  std::lock_guard<std::mutex> lock(height_range_mutex_);
+  if (height_range_ and inserted_height != height_range_->max + 1) {
     log_->warn(
         "Only blocks with sequential heights could be inserted. "
         "Last block height: {}, inserting: {}",
-        opt_range->max,
+        height_range_->max,
         inserted_height);
     return false;
   }
 
-  auto b = block->blob().hex();
-
   soci::session sql(*pool_wrapper_->connection_pool_);
+  bool inserted = data_format_ == BlockDataFormat::kBinary
+      ? insertBinary(sql, inserted_height, block->blob())
+      : insertHexText(sql, inserted_height, block->blob());
+  if (inserted) {
+    height_range_ = height_range_
+        ? HeightRange{height_range_->min, inserted_height}
+        : HeightRange{inserted_height, inserted_height};
+  } else {
+    // the table might have been changed bypassing the cache
+    height_range_ = queryBlockHeightsRange();
+  }
+  return inserted;
+}
+
+bool PostgresBlockStorage::insertHexText(
+    soci::session &sql,
+    HeightType height,
+    const shared_model::crypto::Blob &blob) {
+  auto b = blob.hex();
   soci::statement st = (sql.prepare << "INSERT INTO " << table_
                                     << " (height, block_data) VALUES(:height, "
                                        ":block_data)",
-                        soci::use(inserted_height),
+                        soci::use(height),
                         soci::use(b));
-  log_->debug("insert block {}: {}", inserted_height, b);
+  log_->debug("insert block {}: {}", height, b);
   try {
     st.execute(true);
     return true;
   } catch (const std::exception &e) {
-    log_->warn(
-        "Failed to insert block {}, reason {}", inserted_height, e.what());
+    log_->warn("Failed to insert block {}, reason {}", height, e.what());
     return false;
   }
 }
 
-boost::optional<std::shared_ptr<const shared_model::interface::Block>>
-PostgresBlockStorage::fetch(HeightType height) const {
-  soci::session sql(*pool_wrapper_->connection_pool_);
+bool PostgresBlockStorage::insertBinary(soci::session &sql,
+                                        HeightType height,
+                                        const shared_model::crypto::Blob &blob) {
+  // soci binds parameters as text only, so bytea is passed through libpq
+  auto height_str = std::to_string(height);
+  const auto &bytes = blob.blob();
+  const char *values[] = {height_str.c_str(),
+                          reinterpret_cast<const char *>(bytes.data())};
+  const int lengths[] = {0, static_cast<int>(bytes.size())};
+  const int formats[] = {kTextFormat, kBinaryFormat};
+  auto query = "INSERT INTO " + table_
+      + " (height, block_data) VALUES($1::bigint, $2::bytea)";
+
+  log_->debug("insert block {}: {} bytes", height, bytes.size());
+  PgResultPtr result(PQexecParams(getConnection(sql),
+                                  query.c_str(),
+                                  2,
+                                  nullptr,
+                                  values,
+                                  lengths,
+                                  formats,
+                                  kTextFormat),
+                     &PQclear);
+  if (PQresultStatus(result.get()) != PGRES_COMMAND_OK) {
+    log_->warn("Failed to insert block {}, reason {}",
+               height,
+               PQresultErrorMessage(result.get()));
+    return false;
+  }
+  return true;
+}
+
+boost::optional<std::string> PostgresBlockStorage::fetchBinary(
+    soci::session &sql, HeightType height) const {
+  auto height_str = std::to_string(height);
+  const char *values[] = {height_str.c_str()};
+  auto query = "SELECT block_data FROM " + table_ + " WHERE height = $1";
+
+  PgResultPtr result(PQexecParams(getConnection(sql),
+                                  query.c_str(),
+                                  1,
+                                  nullptr,
+                                  values,
+                                  nullptr,
+                                  nullptr,
+                                  kBinaryFormat),
+                     &PQclear);
+  if (PQresultStatus(result.get()) != PGRES_TUPLES_OK) {
+    log_->error("Failed to execute query: {}",
+                PQresultErrorMessage(result.get()));
+    return boost::none;
+  }
+  if (PQntuples(result.get()) == 0 or PQgetisnull(result.get(), 0, 0)) {
+    return boost::none;
+  }
+  return std::string(PQgetvalue(result.get(), 0, 0),
+                     PQgetlength(result.get(), 0, 0));
+}
+
+boost::optional<std::string> PostgresBlockStorage::fetchHexText(
+    soci::session &sql, HeightType height) const {
   using QueryTuple = boost::tuple<boost::optional<std::string>>;
   QueryTuple row;
   try {
@@ -67,35 +159,49 @@ PostgresBlockStorage::fetch(HeightType height) const {
     log_->error("Failed to execute query: {}", e.what());
     return boost::none;
   }
-  return rebind(viewQuery<QueryTuple>(row)) | [&, this](auto row) {
-    return iroha::ametsuchi::apply(row, [&, this](auto &block_data) {
-      log_->debug("fetched: {}", block_data);
-      return iroha::hexstringToBytestring(block_data) |
-          [&, this](auto byte_block) {
-            iroha::protocol::Block_v1 b1;
-            b1.ParseFromString(byte_block);
-            iroha::protocol::Block block;
-            *block.mutable_block_v1() = b1;
-            return block_factory_->createBlock(std::move(block))
-                .match(
-                    [&](auto &&v) {
-                      return boost::make_optional(
-                          std::shared_ptr<const shared_model::interface::Block>(
-                              std::move(v.value)));
-                    },
-                    [&](const auto &e)
-                        -> boost::optional<std::shared_ptr<
-                            const shared_model::interface::Block>> {
-                      log_->error("Could not build block at height {}: {}",
-                                  height,
-                                  e.error);
-                      return boost::none;
-                    });
-          };
+  return rebind(viewQuery<QueryTuple>(row)) | [](auto row) {
+    return iroha::ametsuchi::apply(row, [](auto &block_data) {
+      return iroha::hexstringToBytestring(block_data);
     });
   };
 }
 
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+PostgresBlockStorage::parseBlock(const std::string &block_data,
+                                 HeightType height) const {
+  iroha::protocol::Block block;
+  if (not block.mutable_block_v1()->ParseFromString(block_data)) {
+    log_->error("Could not parse block at height {}", height);
+    return boost::none;
+  }
+  return block_factory_->createBlock(std::move(block))
+      .match(
+          [&](auto &&v) {
+            return boost::make_optional(
+                std::shared_ptr<const shared_model::interface::Block>(
+                    std::move(v.value)));
+          },
+          [&](const auto &e)
+              -> boost::optional<
+                  std::shared_ptr<const shared_model::interface::Block>> {
+            log_->error(
+                "Could not build block at height {}: {}", height, e.error);
+            return boost::none;
+          });
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+PostgresBlockStorage::fetch(HeightType height) const {
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  auto block_data = data_format_ == BlockDataFormat::kBinary
+      ? fetchBinary(sql, height)
+      : fetchHexText(sql, height);
+  return block_data | [&, this](const auto &block_data) {
+    log_->debug("fetched block {}: {} bytes", height, block_data.size());
+    return this->parseBlock(block_data, height);
+  };
+}
+
 size_t PostgresBlockStorage::size() const {
   return (getBlockHeightsRange() |
           [](auto range) {
@@ -105,18 +211,20 @@ size_t PostgresBlockStorage::size() const {
 }
 
 void PostgresBlockStorage::clear() {
+  std::lock_guard<std::mutex> lock(height_range_mutex_);
   soci::session sql(*pool_wrapper_->connection_pool_);
   soci::statement st = (sql.prepare << "TRUNCATE " << table_);
   try {
     st.execute(true);
+    height_range_ = boost::none;
   } catch (const std::exception &e) {
     log_->warn("Failed to clear {} table, reason {}", table_, e.what());
+    height_range_ = queryBlockHeightsRange();
   }
 }
 
 void PostgresBlockStorage::forEach(
     iroha::ametsuchi::BlockStorage::FunctionType function) const {
-  soci::session sql(*pool_wrapper_->connection_pool_);
   getBlockHeightsRange() | [this, &function](auto range) {
     while (range.min <= range.max) {
       function(*this->fetch(range.min));
@@ -127,8 +235,12 @@ void PostgresBlockStorage::forEach(
 
 boost::optional<PostgresBlockStorage::HeightRange>
 PostgresBlockStorage::getBlockHeightsRange() const {
-  // TODO: IR-577 Add caching if it will gain a performance boost
-  // luckychess 29.06.2019
+  std::lock_guard<std::mutex> lock(height_range_mutex_);
+  return height_range_;
+}
+
+boost::optional<PostgresBlockStorage::HeightRange>
+PostgresBlockStorage::queryBlockHeightsRange() const {
   soci::session sql(*pool_wrapper_->connection_pool_);
   using QueryTuple =
       boost::tuple<boost::optional<size_t>, boost::optional<size_t>>;
@@ -155,6 +267,7 @@ PostgresTemporaryBlockStorage::PostgresTemporaryBlockStorage(
     : PostgresBlockStorage(std::move(pool_wrapper),
                            std::move(block_factory),
                            std::move(table),
+                           BlockDataFormat::kBinary,
                            std::move(log)) {}
 
 PostgresTemporaryBlockStorage::~PostgresTemporaryBlockStorage() {
@@ -8,6 +8,8 @@
 
 #include "ametsuchi/block_storage.hpp"
 
+#include <mutex>
+
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/protobuf/block.hpp"
@@ -21,9 +23,18 @@ namespace iroha {
      public:
       using BlockTransportFactory = shared_model::proto::ProtoBlockFactory;
 
+      /// Representation of serialized blocks in the table
+      enum class BlockDataFormat {
+        /// hex string in text column, used by tables of previous versions
+        kHexText,
+        /// raw bytes in bytea column
+        kBinary
+      };
+
       PostgresBlockStorage(std::shared_ptr<PoolWrapper> pool_wrapper,
                            std::shared_ptr<BlockTransportFactory> block_factory,
                            std::string table,
+                           BlockDataFormat data_format,
                            logger::LoggerPtr log);
 
       bool insert(
@@ -44,14 +55,49 @@ namespace iroha {
         shared_model::interface::types::HeightType max;
       };
 
-      /// Get the range of stored block heights.
+      /// Get the cached range of stored block heights.
       boost::optional<HeightRange> getBlockHeightsRange() const;
 
+      /// Query the range of stored block heights from the database.
+      boost::optional<HeightRange> queryBlockHeightsRange() const;
+
+      /// Insert block as hex string
+      bool insertHexText(soci::session &sql,
+                         shared_model::interface::types::HeightType height,
+                         const shared_model::crypto::Blob &blob);
+
+      /// Insert block bytes using binary parameter binding
+      bool insertBinary(soci::session &sql,
+                        shared_model::interface::types::HeightType height,
+                        const shared_model::crypto::Blob &blob);
+
+      /// Fetch block bytes using binary result format
+      boost::optional<std::string> fetchBinary(
+          soci::session &sql,
+          shared_model::interface::types::HeightType height) const;
+
+      /// Fetch block bytes stored as hex string
+      boost::optional<std::string> fetchHexText(
+          soci::session &sql,
+          shared_model::interface::types::HeightType height) const;
+
+      /// Create block from serialized Block_v1 message
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      parseBlock(const std::string &block_data,
+                 shared_model::interface::types::HeightType height) const;
+
      protected:
       std::shared_ptr<PoolWrapper> pool_wrapper_;
       std::shared_ptr<BlockTransportFactory> block_factory_;
       std::string table_;
+      BlockDataFormat data_format_;
       logger::LoggerPtr log_;
+
+     private:
+      /// Range of stored block heights, which is maintained on insert and
+      /// clear instead of being queried on each call
+      mutable std::mutex height_range_mutex_;
+      boost::optional<HeightRange> height_range_;
     };
 
     class PostgresTemporaryBlockStorage : public PostgresBlockStorage {
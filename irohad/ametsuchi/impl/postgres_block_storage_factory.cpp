@@ -36,7 +36,7 @@ PostgresBlockStorageFactory::createTable(soci::session &sql,
                                          const std::string &table) {
   soci::statement st =
       (sql.prepare << "CREATE TABLE IF NOT EXISTS " << table
-                   << "(height bigint PRIMARY KEY, block_data text not null)");
+                   << "(height bigint PRIMARY KEY, block_data bytea not null)");
   try {
     st.execute(true);
     return {};
@@ -45,3 +45,46 @@ PostgresBlockStorageFactory::createTable(soci::session &sql,
                                + std::string(e.what()));
   }
 }
+
+iroha::expected::Result<PostgresBlockStorage::BlockDataFormat, std::string>
+PostgresBlockStorageFactory::getBlockDataFormat(soci::session &sql,
+                                                const std::string &table) {
+  boost::optional<std::string> data_type;
+  try {
+    sql << "SELECT data_type FROM information_schema.columns "
+           "WHERE table_schema = current_schema() AND table_name = :table "
+           "AND column_name = 'block_data'",
+        soci::use(table), soci::into(data_type);
+  } catch (const std::exception &e) {
+    return expected::makeError("Unable to get block store format: "
+                               + std::string(e.what()));
+  }
+  if (not data_type) {
+    return expected::makeError("Block store table " + table
+                               + " does not exist");
+  }
+  if (*data_type == "bytea") {
+    return expected::makeValue(PostgresBlockStorage::BlockDataFormat::kBinary);
+  }
+  return expected::makeValue(PostgresBlockStorage::BlockDataFormat::kHexText);
+}
+
+iroha::expected::Result<void, std::string>
+PostgresBlockStorageFactory::migrateToBinary(soci::session &sql,
+                                             const std::string &table) {
+  return getBlockDataFormat(sql, table) |
+             [&](auto format) -> iroha::expected::Result<void, std::string> {
+    if (format == PostgresBlockStorage::BlockDataFormat::kBinary) {
+      return {};
+    }
+    try {
+      sql << "ALTER TABLE " << table
+          << " ALTER COLUMN block_data TYPE bytea "
+             "USING decode(block_data, 'hex')";
+      return {};
+    } catch (const std::exception &e) {
+      return expected::makeError("Unable to migrate block store: "
+                                 + std::string(e.what()));
+    }
+  };
+}
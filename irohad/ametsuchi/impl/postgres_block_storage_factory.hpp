@@ -25,6 +25,26 @@ namespace iroha {
       static iroha::expected::Result<void, std::string> createTable(
           soci::session &sql, const std::string &table);
 
+      /**
+       * Detect representation of blocks in the existing table
+       * @param sql - session to the database
+       * @param table - name of the table
+       * @return format of block_data column or error message
+       */
+      static iroha::expected::
+          Result<PostgresBlockStorage::BlockDataFormat, std::string>
+          getBlockDataFormat(soci::session &sql, const std::string &table);
+
+      /**
+       * Convert hex text representation of blocks in the table to binary one
+       * in place. Does nothing if the table is already binary
+       * @param sql - session to the database
+       * @param table - name of the table
+       * @return error message in case of failure
+       */
+      static iroha::expected::Result<void, std::string> migrateToBinary(
+          soci::session &sql, const std::string &table);
+
      private:
       std::shared_ptr<PoolWrapper> pool_wrapper_;
       std::shared_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
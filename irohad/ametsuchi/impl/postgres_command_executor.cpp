@@ -674,29 +674,26 @@ namespace iroha {
                 WHERE
                   account_id = :target
                   AND CASE
-                    WHEN data ? :creator AND data->:creator ?:key
-                      THEN CASE
-                        WHEN :have_expected_value::boolean
-                            THEN data->:creator->:key = :expected_value::jsonb
-                        ELSE FALSE
-                        END
-                    ELSE not :have_expected_value::boolean
+                    WHEN :have_expected_value::boolean
+                      THEN (SELECT value FROM account_detail
+                            WHERE account_id = :target
+                              AND writer = :creator
+                              AND key = :key) = :expected_value::jsonb
+                    ELSE NOT EXISTS (SELECT * FROM account_detail
+                                     WHERE account_id = :target
+                                       AND writer = :creator
+                                       AND key = :key)
                   END
             ),
             inserted AS
             (
-                UPDATE account
-                SET data = jsonb_set(
-                  CASE
-                    WHEN data ? :creator THEN data
-                    ELSE jsonb_set(data, array[:creator], '{}')
-                  END,
-                  array[:creator, :key], :new_value::jsonb
+                INSERT INTO account_detail(account_id, writer, key, value)
+                (
+                    SELECT :target, :creator, :key, :new_value::jsonb
+                    WHERE EXISTS (SELECT * FROM old_value) %s
                 )
-                WHERE
-                  EXISTS (SELECT * FROM old_value)
-                  AND account_id = :target
-                  %s
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
                 RETURNING (1)
             )
           SELECT CASE
@@ -760,9 +757,9 @@ namespace iroha {
             ),
             insert_account AS
             (
-                INSERT INTO account(account_id, domain_id, quorum, data)
+                INSERT INTO account(account_id, domain_id, quorum)
                 (
-                    SELECT :account_id, :domain, 1, '{}'
+                    SELECT :account_id, :domain, 1
                     WHERE EXISTS (SELECT * FROM insert_signatory)
                       AND EXISTS (SELECT * FROM get_domain_default_role)
                 ) RETURNING (1)
@@ -1103,10 +1100,14 @@ namespace iroha {
           WITH %s
             inserted AS
             (
-                UPDATE account SET data = jsonb_set(
-                CASE WHEN data ? :creator THEN data ELSE
-                jsonb_set(data, array[:creator], '{}') END,
-                array[:creator, :key], :value::jsonb) WHERE account_id=:target %s
+                INSERT INTO account_detail(account_id, writer, key, value)
+                (
+                    SELECT :target, :creator, :key, :value::jsonb
+                    WHERE EXISTS
+                        (SELECT * FROM account WHERE account_id = :target) %s
+                )
+                ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
                 RETURNING (1)
             )
           SELECT CASE
@@ -5,34 +5,70 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <soci/postgresql/soci-postgresql.h>
 #include <soci/soci.h>
-#include <boost/format.hpp>
 #include "cryptography/hash.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace shared_model::interface::types;
 
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+  /// Get libpq connection which is used by soci session
+  PGconn *getConnection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  /// Append value escaped according to COPY text format
+  void appendEscaped(std::string &rows, const std::string &value) {
+    for (auto c : value) {
+      switch (c) {
+        case '\\':
+          rows.append("\\\\");
+          break;
+        case '\t':
+          rows.append("\\t");
+          break;
+        case '\n':
+          rows.append("\\n");
+          break;
+        case '\r':
+          rows.append("\\r");
+          break;
+        default:
+          rows.push_back(c);
+      }
+    }
+  }
+
+  /// Append a row of tab separated values in COPY text format
+  void appendRow(std::string &rows, std::initializer_list<std::string> values) {
+    const char *separator = "";
+    for (const auto &value : values) {
+      rows.append(separator);
+      appendEscaped(rows, value);
+      separator = "\t";
+    }
+    rows.push_back('\n');
+  }
+}  // namespace
+
 PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
 
 void PostgresIndexer::txHashPosition(const HashType &hash,
                                      TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_hash"
-      "(hash, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append(
-      (base % hash.hex() % position.height % position.index).str());
+  appendRow(position_by_hash_.rows,
+            {hash.hex(),
+             std::to_string(position.height),
+             std::to_string(position.index)});
 }
 
 void PostgresIndexer::txHashStatus(const HashType &rejected_tx_hash,
                                    bool is_committed) {
-  boost::format base(
-      "INSERT INTO tx_status_by_hash"
-      "(hash, status) VALUES "
-      "('%s', '%s');\n");
-  statements_.append(
-      (base % rejected_tx_hash.hex() % (is_committed ? "TRUE" : "FALSE"))
-          .str());
+  appendRow(tx_status_by_hash_.rows,
+            {rejected_tx_hash.hex(), is_committed ? "t" : "f"});
 }
 
 void PostgresIndexer::committedTxHash(const HashType &committed_tx_hash) {
@@ -45,29 +81,91 @@ void PostgresIndexer::rejectedTxHash(const HashType &rejected_tx_hash) {
 
 void PostgresIndexer::txPositionByCreator(const AccountIdType creator,
                                           TxPosition position) {
-  boost::format base(
-      "INSERT INTO tx_position_by_creator"
-      "(creator_id, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append((base % creator % position.height % position.index).str());
+  appendRow(tx_position_by_creator_.rows,
+            {creator,
+             std::to_string(position.height),
+             std::to_string(position.index)});
 }
 
 void PostgresIndexer::accountAssetTxPosition(const AccountIdType &account_id,
                                              const AssetIdType &asset_id,
                                              TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_account_asset"
-      "(account_id, asset_id, height, index) VALUES "
-      "('%s', '%s', '%s', '%s');\n");
-  statements_.append(
-      (base % account_id % asset_id % position.height % position.index).str());
+  appendRow(position_by_account_asset_.rows,
+            {account_id,
+             asset_id,
+             std::to_string(position.height),
+             std::to_string(position.index)});
 }
 
-iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
-  try {
-    sql_ << statements_;
-  } catch (const std::exception &e) {
-    return e.what();
+void PostgresIndexer::topBlock(HeightType height, const HashType &hash) {
+  top_block_ = std::make_pair(height, hash.hex());
+}
+
+iroha::expected::Result<void, std::string> PostgresIndexer::copy(
+    const CopyData &data) {
+  if (data.rows.empty()) {
+    return {};
+  }
+  auto conn = getConnection(sql_);
+  auto query = std::string{"COPY "} + data.target + " FROM STDIN";
+  PgResultPtr result(PQexec(conn, query.c_str()), &PQclear);
+  if (PQresultStatus(result.get()) != PGRES_COPY_IN) {
+    return std::string{PQresultErrorMessage(result.get())};
+  }
+
+  std::string error;
+  if (PQputCopyData(conn, data.rows.data(), static_cast<int>(data.rows.size()))
+      != 1) {
+    error = PQerrorMessage(conn);
+  }
+  // an error message passed to PQputCopyEnd aborts the COPY
+  if (PQputCopyEnd(conn, error.empty() ? nullptr : error.c_str()) != 1
+      and error.empty()) {
+    error = PQerrorMessage(conn);
+  }
+  while (auto next = PQgetResult(conn)) {
+    result.reset(next);
+    if (PQresultStatus(result.get()) != PGRES_COMMAND_OK and error.empty()) {
+      error = PQresultErrorMessage(result.get());
+    }
+  }
+  if (not error.empty()) {
+    return error;
   }
   return {};
 }
+
+iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
+  iroha::expected::Result<void, std::string> result = {};
+  for (auto data : {&position_by_hash_,
+                    &tx_status_by_hash_,
+                    &tx_position_by_creator_,
+                    &position_by_account_asset_}) {
+    if (iroha::expected::hasValue(result)) {
+      result = copy(*data);
+    }
+  }
+  if (iroha::expected::hasValue(result) and top_block_) {
+    try {
+      sql_ << "INSERT INTO top_block_info (height, hash) "
+              "VALUES (:height, :hash) ON CONFLICT (lock) DO UPDATE "
+              "SET height = EXCLUDED.height, hash = EXCLUDED.hash",
+          soci::use(top_block_->first, "height"),
+          soci::use(top_block_->second, "hash");
+    } catch (const std::exception &e) {
+      result = std::string{e.what()};
+    }
+  }
+  discard();
+  return result;
+}
+
+void PostgresIndexer::discard() {
+  for (auto data : {&position_by_hash_,
+                    &tx_status_by_hash_,
+                    &tx_position_by_creator_,
+                    &position_by_account_asset_}) {
+    data->rows.clear();
+  }
+  top_block_ = boost::none;
+}
@@ -8,6 +8,10 @@
 
 #include "ametsuchi/indexer.hpp"
 
+#include <utility>
+
+#include <boost/optional.hpp>
+
 namespace soci {
   class session;
 }
@@ -37,16 +41,45 @@ namespace iroha {
           const shared_model::interface::types::AssetIdType &asset_id,
           TxPosition position) override;
 
+      void topBlock(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash) override;
+
       iroha::expected::Result<void, std::string> flush() override;
 
+      void discard() override;
+
      private:
+      /// Rows of a table which are sent with COPY on flush().
+      struct CopyData {
+        /// table name with the list of copied columns
+        const char *target;
+        /// rows in COPY text format
+        std::string rows;
+      };
+
       /// Index tx status by its hash.
       void txHashStatus(
           const shared_model::interface::types::HashType &rejected_tx_hash,
           bool is_committed);
 
+      /**
+       * Send collected rows of a table to the database with a single COPY.
+       * @return Void Value on success, string Error on failure.
+       */
+      iroha::expected::Result<void, std::string> copy(const CopyData &data);
+
       soci::session &sql_;
-      std::string statements_;  ///< A bunch of SQL to be committed on flush().
+      CopyData position_by_hash_{"position_by_hash (hash, height, index)", {}};
+      CopyData tx_status_by_hash_{"tx_status_by_hash (hash, status)", {}};
+      CopyData tx_position_by_creator_{
+          "tx_position_by_creator (creator_id, height, index)", {}};
+      CopyData position_by_account_asset_{
+          "position_by_account_asset (account_id, asset_id, height, index)",
+          {}};
+      boost::optional<
+          std::pair<shared_model::interface::types::HeightType, std::string>>
+          top_block_;
     };
 
   }  // namespace ametsuchi
@@ -69,14 +69,16 @@ PostgresOptions::PostgresOptions(const std::string &host,
                                  const std::string &password,
                                  const std::string &working_dbname,
                                  const std::string &maintenance_dbname,
-                                 logger::LoggerPtr log)
+                                 logger::LoggerPtr log,
+                                 boost::optional<Replica> replica)
     : host_(host),
       port_(port),
       user_(user),
       password_(password),
       working_dbname_(working_dbname),
       maintenance_dbname_(maintenance_dbname),
-      prepared_block_name_(kPreparedBlockPrefix + working_dbname_) {
+      prepared_block_name_(kPreparedBlockPrefix + working_dbname_),
+      replica_(std::move(replica)) {
   if (working_dbname_ == maintenance_dbname_) {
     log->warn(
         "Working database has the same name with maintenance database: '{}'. "
@@ -104,6 +106,13 @@ std::string PostgresOptions::getConnectionStringWithDbName(
   return connectionStringWithoutDbName() + " dbname=" + dbname;
 }
 
+std::string PostgresOptions::getConnectionString(
+    const std::string &host, uint16_t port, const std::string &dbname) const {
+  return (boost::format("host=%1% port=%2% user=%3% password=%4% dbname=%5%")
+          % host % port % user_ % password_ % dbname)
+      .str();
+}
+
 std::string PostgresOptions::workingDbName() const {
   return working_dbname_;
 }
@@ -115,3 +124,19 @@ std::string PostgresOptions::maintenanceDbName() const {
 const std::string &PostgresOptions::preparedBlockName() const {
   return prepared_block_name_;
 }
+
+boost::optional<std::string> PostgresOptions::replicaConnectionString() const {
+  if (not replica_) {
+    return boost::none;
+  }
+  return getConnectionString(replica_->host, replica_->port, working_dbname_);
+}
+
+boost::optional<std::string>
+PostgresOptions::replicaMaintenanceConnectionString() const {
+  if (not replica_) {
+    return boost::none;
+  }
+  return getConnectionString(
+      replica_->host, replica_->port, maintenance_dbname_);
+}
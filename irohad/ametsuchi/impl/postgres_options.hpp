@@ -7,6 +7,8 @@
 #define IROHA_POSTGRES_OPTIONS_HPP
 
 #include <unordered_map>
+
+#include <boost/optional.hpp>
 #include "common/result.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -18,6 +20,12 @@ namespace iroha {
      */
     class PostgresOptions {
      public:
+      /// Address of a read-only standby of the working database
+      struct Replica {
+        std::string host;
+        uint16_t port;
+      };
+
       /**
        * @param pg_opt The connection options string.
        * @param default_dbname The default name of database to use when one is
@@ -40,6 +48,8 @@ namespace iroha {
        * purposes. It will not be altered in any way and is used to manage
        * working database.
        * @param log Logger for internal messages.
+       * @param replica Standby replicating the working database, which is
+       * accessed with the same user and database names.
        */
       PostgresOptions(const std::string &host,
                       uint16_t port,
@@ -47,7 +57,8 @@ namespace iroha {
                       const std::string &password,
                       const std::string &working_dbname,
                       const std::string &maintenance_dbname,
-                      logger::LoggerPtr log);
+                      logger::LoggerPtr log,
+                      boost::optional<Replica> replica = boost::none);
 
       /// @return connection string without dbname param
       std::string connectionStringWithoutDbName() const;
@@ -67,10 +78,22 @@ namespace iroha {
       /// @return prepared block name
       const std::string &preparedBlockName() const;
 
+      /// @return connection string to working database on the replica, if
+      /// it is set
+      boost::optional<std::string> replicaConnectionString() const;
+
+      /// @return connection string to maintenance database on the replica,
+      /// if it is set
+      boost::optional<std::string> replicaMaintenanceConnectionString() const;
+
      private:
       std::string getConnectionStringWithDbName(
           const std::string &dbname) const;
 
+      std::string getConnectionString(const std::string &host,
+                                      uint16_t port,
+                                      const std::string &dbname) const;
+
       const std::string host_;
       const uint16_t port_;
       const std::string user_;
@@ -78,6 +101,7 @@ namespace iroha {
       const std::string working_dbname_;
       const std::string maintenance_dbname_;
       const std::string prepared_block_name_;
+      const boost::optional<Replica> replica_;
     };
 
   }  // namespace ametsuchi
@@ -50,14 +50,6 @@ namespace {
   const auto kRootRolePermStr =
       shared_model::interface::RolePermissionSet({Role::kRoot}).toBitstring();
 
-  shared_model::interface::types::DomainIdType getDomainFromName(
-      const shared_model::interface::types::AccountIdType &account_id) {
-    // TODO 03.10.18 andrei: IR-1728 Move getDomainFromName to shared_model
-    std::vector<std::string> res;
-    boost::split(res, account_id, boost::is_any_of("@"));
-    return res.at(1);
-  }
-
   std::string getAccountRolePermissionCheckSql(
       shared_model::interface::permissions::Role permission,
       const std::string &account_alias = ":role_account_id") {
@@ -85,13 +77,12 @@ namespace {
    * permissions for target account
    * It verifies individual, domain, and global permissions, and returns true if
    * any of listed permissions is present
+   * The accounts are bound as :creator_id and :target_account_id parameters,
+   * so the text of the subquery does not depend on them
    */
-  auto hasQueryPermission(
-      const shared_model::interface::types::AccountIdType &creator,
-      const shared_model::interface::types::AccountIdType &target_account,
-      Role indiv_permission_id,
-      Role all_permission_id,
-      Role domain_permission_id) {
+  auto hasQueryPermission(Role indiv_permission_id,
+                          Role all_permission_id,
+                          Role domain_permission_id) {
     const auto bits = shared_model::interface::RolePermissionSet::size();
     const auto perm_str =
         shared_model::interface::RolePermissionSet({indiv_permission_id})
@@ -103,39 +94,38 @@ namespace {
         shared_model::interface::RolePermissionSet({domain_permission_id})
             .toBitstring();
 
-    const std::string creator_quoted{(boost::format("'%s'") % creator).str()};
-
     boost::format cmd(R"(
     WITH
         has_root_perm AS (%1%),
         has_indiv_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%4%') = '%4%' FROM role_has_permissions AS rp
+          & '%3%') = '%3%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+              WHERE ar.account_id = :creator_id
         ),
         has_all_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%5%') = '%5%' FROM role_has_permissions AS rp
+          & '%4%') = '%4%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+              WHERE ar.account_id = :creator_id
         ),
         has_domain_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%6%') = '%6%' FROM role_has_permissions AS rp
+          & '%5%') = '%5%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+              WHERE ar.account_id = :creator_id
         )
     SELECT (SELECT * from has_root_perm)
-        OR ('%3%' = '%7%' AND (SELECT * FROM has_indiv_perm))
+        OR (CAST(:creator_id AS text) = CAST(:target_account_id AS text)
+            AND (SELECT * FROM has_indiv_perm))
         OR (SELECT * FROM has_all_perm)
-        OR ('%8%' = '%9%' AND (SELECT * FROM has_domain_perm)) AS perm
+        OR (split_part(:creator_id, '@', 2)
+              = split_part(:target_account_id, '@', 2)
+            AND (SELECT * FROM has_domain_perm)) AS perm
     )");
 
-    return (cmd % getAccountRolePermissionCheckSql(Role::kRoot, creator_quoted)
-            % bits % creator % perm_str % all_perm_str % domain_perm_str
-            % target_account % getDomainFromName(creator)
-            % getDomainFromName(target_account))
+    return (cmd % getAccountRolePermissionCheckSql(Role::kRoot, ":creator_id")
+            % bits % perm_str % all_perm_str % domain_perm_str)
         .str();
   }
 
@@ -183,6 +173,7 @@ namespace iroha {
 
     PostgresSpecificQueryExecutor::PostgresSpecificQueryExecutor(
         soci::session &sql,
+        std::shared_ptr<PreparedStatements> statements,
         BlockStorage &block_store,
         std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -191,6 +182,7 @@ namespace iroha {
             perm_converter,
         logger::LoggerPtr log)
         : sql_(sql),
+          statements_(std::move(statements)),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_{std::move(response_factory)},
@@ -231,18 +223,18 @@ namespace iroha {
 
     template <typename QueryTuple,
               typename PermissionTuple,
-              typename QueryExecutor,
               typename ResponseCreator,
               typename PermissionsErrResponse>
     QueryExecutorResult PostgresSpecificQueryExecutor::executeQuery(
-        QueryExecutor &&query_executor,
+        const std::string &query,
+        const PreparedStatements::Parameters &parameters,
         const shared_model::interface::types::HashType &query_hash,
         ResponseCreator &&response_creator,
         PermissionsErrResponse &&perms_err_response) {
       using T = concat<QueryTuple, PermissionTuple>;
       try {
-        soci::rowset<T> st = std::forward<QueryExecutor>(query_executor)();
-        auto range = boost::make_iterator_range(st.begin(), st.end());
+        auto rows = statements_->execute<T>(sql_, query, parameters);
+        auto range = boost::make_iterator_range(rows.begin(), rows.end());
 
         return iroha::ametsuchi::apply(
             viewPermissions<PermissionTuple>(range.front()),
@@ -277,13 +269,12 @@ namespace iroha {
         shared_model::interface::permissions::Role permission,
         const std::string &account_id) const {
       using T = boost::tuple<int>;
-      boost::format cmd(R"(%s)");
       try {
-        soci::rowset<T> st =
-            (sql_.prepare
-                 << (cmd % getAccountRolePermissionCheckSql(permission)).str(),
-             soci::use(account_id, "role_account_id"));
-        return st.begin()->get<0>();
+        auto rows = statements_->execute<T>(
+            sql_,
+            getAccountRolePermissionCheckSql(permission),
+            {{"role_account_id", account_id}});
+        return not rows.empty() and rows.front().get<0>();
       } catch (const std::exception &e) {
         log_->error("Failed to validate query: {}", e.what());
         return false;
@@ -327,17 +318,14 @@ namespace iroha {
           error_type, error, error_code, query_hash);
     }
 
-    template <typename Query,
-              typename QueryChecker,
-              typename QueryApplier,
-              typename... Permissions>
+    template <typename Query, typename QueryChecker, typename... Permissions>
     QueryExecutorResult PostgresSpecificQueryExecutor::executeTransactionsQuery(
         const Query &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash,
         QueryChecker &&qry_checker,
         const std::string &related_txs,
-        QueryApplier applier,
+        PreparedStatements::Parameters parameters,
         Permissions... perms) {
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
                                    uint64_t,
@@ -375,8 +363,7 @@ namespace iroha {
       auto first_tx = R"(SELECT height, index FROM position_by_hash
       ORDER BY height, index ASC LIMIT 1)";
 
-      auto cmd = base % hasQueryPermission(creator_id, q.accountId(), perms...)
-          % related_txs;
+      auto cmd = base % hasQueryPermission(perms...) % related_txs;
       if (first_hash) {
         cmd = base % first_by_hash;
       } else {
@@ -385,8 +372,16 @@ namespace iroha {
 
       auto query = cmd.str();
 
+      parameters.emplace_back("creator_id", creator_id);
+      parameters.emplace_back("target_account_id", q.accountId());
+      if (first_hash) {
+        parameters.emplace_back("hash", first_hash->hex());
+      }
+      parameters.emplace_back("page_size", std::to_string(query_size));
+
       return executeQuery<QueryTuple, PermissionTuple>(
-          applier(query),
+          query,
+          parameters,
           query_hash,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -471,8 +466,19 @@ namespace iroha {
       using PermissionTuple = boost::tuple<int>;
 
       auto cmd = (boost::format(R"(WITH has_perms AS (%s),
+      details AS (
+          SELECT jsonb_object_agg(writer, data_by_writer) AS data
+          FROM (
+              SELECT writer, jsonb_object_agg(key, value) AS data_by_writer
+              FROM account_detail
+              WHERE account_id = :target_account_id
+              GROUP BY writer
+          ) by_writer
+      ),
       t AS (
-          SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
+          SELECT a.account_id, a.domain_id, a.quorum,
+              COALESCE((SELECT data FROM details), '{}'::jsonb) AS data,
+              ARRAY_AGG(ar.role_id) AS roles
           FROM account AS a, account_has_roles AS ar
           WHERE a.account_id = :target_account_id
           AND ar.account_id = a.account_id
@@ -481,9 +487,7 @@ namespace iroha {
       SELECT account_id, domain_id, quorum, data, roles, perm
       FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMyAccount,
+                  % hasQueryPermission(Role::kGetMyAccount,
                                        Role::kGetAllAccounts,
                                        Role::kGetDomainAccounts))
                      .str();
@@ -502,10 +506,8 @@ namespace iroha {
       };
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "target_account_id"));
-          },
+          cmd,
+          {{"creator_id", creator_id}, {"target_account_id", q.accountId()}},
           query_hash,
           [this, &q, &query_apply, &query_hash](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -575,20 +577,19 @@ namespace iroha {
       auto cmd = (boost::format(R"(WITH has_perms AS (%s),
       t AS (
           SELECT public_key FROM account_has_signatory
-          WHERE account_id = :account_id
+          WHERE account_id = :target_account_id
       )
       SELECT public_key, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMySignatories,
+                  % hasQueryPermission(Role::kGetMySignatories,
                                        Role::kGetAllSignatories,
                                        Role::kGetDomainSignatories))
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
+          cmd,
+          {{"creator_id", creator_id}, {"target_account_id", q.accountId()}},
           query_hash,
           [this, &q, &query_hash](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -621,29 +622,9 @@ namespace iroha {
         const shared_model::interface::types::HashType &query_hash) {
       std::string related_txs = R"(SELECT DISTINCT height, index
       FROM tx_position_by_creator
-      WHERE creator_id = :account_id
+      WHERE creator_id = :target_account_id
       ORDER BY height, index ASC)";
 
-      const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
-      // retrieve one extra transaction to populate next_hash
-      auto query_size = pagination_info.pageSize() + 1u;
-
-      auto apply_query = [&](const auto &query) {
-        return [&] {
-          if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
-          } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(query_size));
-          }
-        };
-      };
-
       auto check_query = [this](const auto &q) {
         if (this->existsInDb<int>(
                 "account", "account_id", "quorum", q.accountId())) {
@@ -658,7 +639,7 @@ namespace iroha {
                                       query_hash,
                                       std::move(check_query),
                                       related_txs,
-                                      apply_query,
+                                      {},
                                       Role::kGetMyAccTxs,
                                       Role::kGetAllAccTxs,
                                       Role::kGetDomainAccTxs);
@@ -668,12 +649,14 @@ namespace iroha {
         const shared_model::interface::GetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
-      auto escape = [](auto &hash) { return "'" + hash.hex() + "'"; };
-      std::string hash_str = std::accumulate(
+      // hashes are passed as a single array literal, so the query text does
+      // not depend on their number
+      std::string hashes = std::accumulate(
           std::next(q.transactionHashes().begin()),
           q.transactionHashes().end(),
-          escape(q.transactionHashes().front()),
-          [&escape](auto &acc, auto &val) { return acc + "," + escape(val); });
+          "{" + q.transactionHashes().front().hex(),
+          [](auto &acc, auto &val) { return acc + "," + val.hex(); });
+      hashes += "}";
 
       using QueryTuple =
           QueryType<shared_model::interface::types::HeightType, std::string>;
@@ -683,20 +666,19 @@ namespace iroha {
           (boost::format(R"(WITH has_my_perm AS (%s),
       has_all_perm AS (%s),
       t AS (
-          SELECT height, hash FROM position_by_hash WHERE hash IN (%s)
+          SELECT height, hash FROM position_by_hash
+          WHERE hash = ANY(CAST(:hashes AS text[]))
       )
       SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
       RIGHT OUTER JOIN has_all_perm ON TRUE
       )") % getAccountRolePermissionCheckSql(Role::kGetMyTxs, ":account_id")
-           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, ":account_id")
-           % hash_str)
+           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, ":account_id"))
               .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd, soci::use(creator_id, "account_id"));
-          },
+          cmd,
+          {{"account_id", creator_id}, {"hashes", hashes}},
           query_hash,
           [&](auto range, auto &my_perm, auto &all_perm) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -750,32 +732,10 @@ namespace iroha {
         const shared_model::interface::types::HashType &query_hash) {
       std::string related_txs = R"(SELECT DISTINCT height, index
           FROM position_by_account_asset
-          WHERE account_id = :account_id
+          WHERE account_id = :target_account_id
           AND asset_id = :asset_id
           ORDER BY height, index ASC)";  // consider index when changing this
 
-      const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
-      // retrieve one extra transaction to populate next_hash
-      auto query_size = pagination_info.pageSize() + 1u;
-
-      auto apply_query = [&](const auto &query) {
-        return [&] {
-          if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
-          } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(query_size));
-          }
-        };
-      };
-
       auto check_query = [this](const auto &q) {
         if (not this->existsInDb<int>(
                 "account", "account_id", "quorum", q.accountId())) {
@@ -796,7 +756,7 @@ namespace iroha {
                                       query_hash,
                                       std::move(check_query),
                                       related_txs,
-                                      apply_query,
+                                      {{"asset_id", q.assetId()}},
                                       Role::kGetMyAccAstTxs,
                                       Role::kGetAllAccAstTxs,
                                       Role::kGetDomainAccAstTxs);
@@ -821,7 +781,7 @@ namespace iroha {
           from (
               select *
               from account_has_asset
-              where account_id = :account_id
+              where account_id = :target_account_id
               order by asset_id
           ) t
       ),
@@ -851,9 +811,7 @@ namespace iroha {
               page_data
               right join has_perms on true
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMyAccAst,
+                  % hasQueryPermission(Role::kGetMyAccAst,
                                        Role::kGetAllAccAst,
                                        Role::kGetDomainAccAst))
                      .str();
@@ -867,16 +825,16 @@ namespace iroha {
       const auto req_page_size =  // TODO 2019.05.31 mboldyrev make it
                                   // non-optional after IR-516
           pagination_meta | [](const auto &pagination_meta) {
-            return boost::optional<size_t>(pagination_meta.pageSize() + 1);
+            return boost::optional<std::string>(
+                std::to_string(pagination_meta.pageSize() + 1));
           };
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(req_first_asset_id, "first_asset_id"),
-                    soci::use(req_page_size, "page_size"));
-          },
+          cmd,
+          {{"creator_id", creator_id},
+           {"target_account_id", q.accountId()},
+           {"first_asset_id", req_first_asset_id},
+           {"page_size", req_page_size}},
           query_hash,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -943,61 +901,54 @@ namespace iroha {
       with has_perms as (%s),
       detail AS (
           with filtered_plain_data as (
-              select row_number() over () rn, *
-              from (
-                  select
-                      data_by_writer.key writer,
-                      plain_data.key as key,
-                      plain_data.value as value
-                  from
-                      jsonb_each((
-                          select data
-                          from account
-                          where account_id = :account_id
-                      )) data_by_writer,
-                  jsonb_each(data_by_writer.value) plain_data
-                  where
-                      coalesce(data_by_writer.key = :writer, true) and
-                      coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
-              ) t
+              select writer, key, value
+              from account_detail
+              where
+                  account_id = :target_account_id and
+                  coalesce(writer = :writer, true) and
+                  coalesce(key = :key, true)
+          ),
+          page_start as (
+              select writer, key
+              from filtered_plain_data
+              where
+                  coalesce(writer = :first_record_writer, true) and
+                  coalesce(key = :first_record_key, true)
+              order by writer asc, key asc
+              limit 1
           ),
-          page_limits as (
-              select start.rn as start, start.rn + :page_size as end
-                  from (
-                      select rn
-                      from filtered_plain_data
-                      where
-                          coalesce(writer = :first_record_writer, true) and
-                          coalesce(key = :first_record_key, true)
-                      limit 1
-                  ) start
+          page_data as (
+              select
+                  row_number() over (order by d.writer asc, d.key asc) rn,
+                  d.writer,
+                  d.key,
+                  d.value
+              from filtered_plain_data d, page_start
+              where (d.writer, d.key) >= (page_start.writer, page_start.key)
+              order by d.writer asc, d.key asc
+              limit cast(:page_size as integer) + 1
           ),
           total_number as (select count(1) total_number from filtered_plain_data),
           next_record as (
               select writer, key
-              from
-                  filtered_plain_data,
-                  page_limits
-              where rn = page_limits.end
+              from page_data
+              where rn = cast(:page_size as integer) + 1
           ),
           page as (
-              select json_object_agg(writer, data_by_writer) json
+              select json_object_agg(writer, data_by_writer order by writer) json
               from (
-                  select writer, json_object_agg(key, value) data_by_writer
-                  from
-                      filtered_plain_data,
-                      page_limits
-                  where
-                      rn >= page_limits.start and
-                      coalesce(rn < page_limits.end, true)
+                  select
+                      writer,
+                      json_object_agg(key, value order by key) data_by_writer
+                  from page_data
+                  where coalesce(rn <= cast(:page_size as integer), true)
                   group by writer
               ) t
           ),
           target_account_exists as (
             select count(1) val
             from account
-            where account_id = :account_id
+            where account_id = :target_account_id
           )
           select
               page.json json,
@@ -1014,9 +965,7 @@ namespace iroha {
       select detail.*, perm from detail
       right join has_perms on true
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMyAccDetail,
+                  % hasQueryPermission(Role::kGetMyAccDetail,
                                        Role::kGetAllAccDetail,
                                        Role::kGetDomainAccDetail))
                      .str();
@@ -1025,11 +974,11 @@ namespace iroha {
       const auto key = q.key();
       boost::optional<std::string> first_record_writer;
       boost::optional<std::string> first_record_key;
-      boost::optional<size_t> page_size;
+      boost::optional<std::string> page_size;
       // TODO 2019.05.29 mboldyrev IR-516 remove when pagination is made
       // mandatory
       q.paginationMeta() | [&](const auto &pagination_meta) {
-        page_size = pagination_meta.pageSize();
+        page_size = std::to_string(pagination_meta.pageSize());
         pagination_meta.firstRecordId() | [&](const auto &first_record_id) {
           first_record_writer = first_record_id.writer();
           first_record_key = first_record_id.key();
@@ -1037,15 +986,14 @@ namespace iroha {
       };
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(writer, "writer"),
-                    soci::use(key, "key"),
-                    soci::use(first_record_writer, "first_record_writer"),
-                    soci::use(first_record_key, "first_record_key"),
-                    soci::use(page_size, "page_size"));
-          },
+          cmd,
+          {{"creator_id", creator_id},
+           {"target_account_id", q.accountId()},
+           {"writer", writer},
+           {"key", key},
+           {"first_record_writer", first_record_writer},
+           {"first_record_key", first_record_key},
+           {"page_size", page_size}},
           query_hash,
           [&, this](auto range, auto &) {
             if (range.empty()) {
@@ -1153,10 +1101,8 @@ namespace iroha {
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id, "role_account_id"));
-          },
+          cmd,
+          {{"role_account_id", creator_id}},
           query_hash,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -1190,11 +1136,8 @@ namespace iroha {
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id, "role_account_id"),
-                    soci::use(q.roleId(), "role_name"));
-          },
+          cmd,
+          {{"role_account_id", creator_id}, {"role_name", q.roleId()}},
           query_hash,
           [this, &q, &creator_id, &query_hash](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -1235,11 +1178,8 @@ namespace iroha {
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id, "role_account_id"),
-                    soci::use(q.assetId(), "asset_id"));
-          },
+          cmd,
+          {{"role_account_id", creator_id}, {"asset_id", q.assetId()}},
           query_hash,
           [this, &q, &creator_id, &query_hash](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -1343,10 +1283,8 @@ namespace iroha {
                      .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id, "role_account_id"));
-          },
+          cmd,
+          {{"role_account_id", creator_id}},
           query_hash,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -1375,12 +1313,13 @@ namespace iroha {
         const std::string &value) const {
       auto cmd = (boost::format(R"(SELECT %s
                                    FROM %s
-                                   WHERE %s = '%s'
+                                   WHERE %s = :value
                                    LIMIT 1)")
-                  % value_name % table_name % key_name % value)
+                  % value_name % table_name % key_name)
                      .str();
-      soci::rowset<ReturnValueType> result = this->sql_.prepare << cmd;
-      return result.begin() != result.end();
+      return not statements_
+                     ->execute<ReturnValueType>(sql_, cmd, {{"value", value}})
+                     .empty();
     }
 
   }  // namespace ametsuchi
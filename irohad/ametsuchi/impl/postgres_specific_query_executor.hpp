@@ -9,6 +9,7 @@
 #include "ametsuchi/specific_query_executor.hpp"
 
 #include <soci/soci.h>
+#include "ametsuchi/impl/prepared_statements.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -50,6 +51,7 @@ namespace iroha {
      public:
       PostgresSpecificQueryExecutor(
           soci::session &sql,
+          std::shared_ptr<PreparedStatements> statements,
           BlockStorage &block_store,
           std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -145,12 +147,12 @@ namespace iroha {
        * Execute query and return its response
        * @tparam QueryTuple - types of values, returned by the query
        * @tparam PermissionTuple - permissions, needed for the query
-       * @tparam QueryExecutor - type of function, which executes the query
        * @tparam ResponseCreator - type of function, which creates response of
        * the query, successful or error one
        * @tparam PermissionsErrResponse - type of function, which creates error
        * response in case something wrong with permissions
-       * @param query_executor - function, executing query
+       * @param query - text of the query, prepared once per connection
+       * @param parameters - values of named parameters of the query
        * @param query_hash - hash of query
        * @param response_creator - function, creating query response
        * @param perms_err_response - function, creating error response
@@ -158,11 +160,11 @@ namespace iroha {
        */
       template <typename QueryTuple,
                 typename PermissionTuple,
-                typename QueryExecutor,
                 typename ResponseCreator,
                 typename PermissionsErrResponse>
       QueryExecutorResult executeQuery(
-          QueryExecutor &&query_executor,
+          const std::string &query,
+          const PreparedStatements::Parameters &parameters,
           const shared_model::interface::types::HashType &query_hash,
           ResponseCreator &&response_creator,
           PermissionsErrResponse &&perms_err_response);
@@ -192,14 +194,12 @@ namespace iroha {
        * hash is not specified and 0 transaction are returned as a query result
        * @param related_txs - SQL query which returns transaction relevant
        * to this query
-       * @param applier - function which accepts SQL
-       * and returns another function which executes that query
+       * @param parameters - values of named parameters of related_txs
        * @param perms - permissions, necessary to execute the query
        * @return Result of a query execution
        */
       template <typename Query,
                 typename QueryChecker,
-                typename QueryApplier,
                 typename... Permissions>
       QueryExecutorResult executeTransactionsQuery(
           const Query &query,
@@ -207,7 +207,7 @@ namespace iroha {
           const shared_model::interface::types::HashType &query_hash,
           QueryChecker &&qry_checker,
           const std::string &related_txs,
-          QueryApplier applier,
+          PreparedStatements::Parameters parameters,
           Permissions... perms);
 
       /**
@@ -253,6 +253,7 @@ namespace iroha {
       };
 
       soci::session &sql_;
+      std::shared_ptr<PreparedStatements> statements_;
       BlockStorage &block_store_;
       std::shared_ptr<PendingTransactionStorage> pending_txs_storage_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
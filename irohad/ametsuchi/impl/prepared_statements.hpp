@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PREPARED_STATEMENTS_HPP
+#define IROHA_PREPARED_STATEMENTS_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <soci/soci.h>
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Server-side prepared statements of a single pooled connection, which
+     * are reused by every query executor leasing that connection. Each query
+     * text is prepared once and then only executed with new parameters, so
+     * Postgres does not parse and plan it again.
+     * Not thread safe: must be used only by the holder of the connection.
+     */
+    class PreparedStatements {
+     public:
+      /// Named parameters of a query, none is passed as NULL
+      using Parameters =
+          std::vector<std::pair<std::string, boost::optional<std::string>>>;
+
+      /**
+       * Execute query, preparing it on the first call
+       * @tparam Row - type of a result row
+       * @param sql - session leasing the connection of this cache
+       * @param query - query text with named parameters
+       * @param parameters - values of the parameters
+       * @return all result rows
+       * @throws soci::soci_error if execution fails. The failed statement is
+       * dropped from the cache, so it is prepared again on the next call
+       */
+      template <typename Row>
+      std::vector<Row> execute(soci::session &sql,
+                               const std::string &query,
+                               const Parameters &parameters) {
+        auto &statement = getStatement(sql, query);
+        std::vector<Row> rows;
+        Row row;
+        try {
+          for (const auto &parameter : parameters) {
+            statement.exchange(soci::use(parameter.second, parameter.first));
+          }
+          statement.define_and_bind();
+          statement.exchange_for_rowset(soci::into(row));
+          statement.execute();
+          while (statement.fetch()) {
+            rows.push_back(row);
+          }
+          statement.bind_clean_up();
+        } catch (...) {
+          statements_.erase(query);
+          throw;
+        }
+        return rows;
+      }
+
+     private:
+      soci::statement &getStatement(soci::session &sql,
+                                    const std::string &query) {
+        auto it = statements_.find(query);
+        if (it == statements_.end()) {
+          it = statements_
+                   .emplace(query,
+                            std::make_unique<soci::statement>(sql.prepare
+                                                              << query))
+                   .first;
+        }
+        return *it->second;
+      }
+
+      std::unordered_map<std::string, std::unique_ptr<soci::statement>>
+          statements_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_PREPARED_STATEMENTS_HPP
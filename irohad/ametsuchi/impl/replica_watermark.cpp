@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/replica_watermark.hpp"
+
+using namespace iroha::ametsuchi;
+
+ReplicaWatermark::ReplicaWatermark(std::chrono::milliseconds ttl) : ttl_(ttl) {}
+
+bool ReplicaWatermark::caughtUp(HeightType committed_height,
+                                const HeightGetter &get_replica_height) {
+  if (committed_height == 0) {
+    return true;
+  }
+  auto now = std::chrono::steady_clock::now();
+  // the height is fetched under the lock, so that concurrent queries wait
+  // for a single round trip instead of making their own
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (not fetched_at_ or now - *fetched_at_ >= ttl_) {
+    replica_height_ = get_replica_height();
+    fetched_at_ = now;
+  }
+  return replica_height_ and *replica_height_ >= committed_height;
+}
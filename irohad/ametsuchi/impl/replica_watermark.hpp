@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_REPLICA_WATERMARK_HPP
+#define IROHA_REPLICA_WATERMARK_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Tells whether a read replica has applied every committed block. The
+     * replica height is fetched at most once per time to live, so that a
+     * query does not pay an extra round trip to the replica.
+     */
+    class ReplicaWatermark {
+     public:
+      using HeightType = shared_model::interface::types::HeightType;
+      /// Fetches the height of the replica, none if it is unknown
+      using HeightGetter = std::function<boost::optional<HeightType>()>;
+
+      /**
+       * @param ttl - time during which the fetched replica height is used
+       */
+      explicit ReplicaWatermark(std::chrono::milliseconds ttl);
+
+      /**
+       * @param committed_height - height of the last committed block
+       * @param get_replica_height - fetches the replica height, called only
+       * if the cached one is outdated
+       * @return true if the replica is not behind the committed ledger
+       */
+      bool caughtUp(HeightType committed_height,
+                    const HeightGetter &get_replica_height);
+
+     private:
+      const std::chrono::milliseconds ttl_;
+
+      std::mutex mutex_;
+      boost::optional<HeightType> replica_height_;
+      boost::optional<std::chrono::steady_clock::time_point> fetched_at_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_REPLICA_WATERMARK_HPP
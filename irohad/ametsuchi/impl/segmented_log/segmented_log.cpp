@@ -0,0 +1,528 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "common/bind.hpp"
+#include "common/files.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using Identifier = SegmentedLog::Identifier;
+using Segment = SegmentedLog::Segment;
+
+const char *SegmentedLog::kSegmentExtension = ".seg";
+const char *SegmentedLog::kIndexExtension = ".idx";
+const char *SegmentedLog::kTmpExtension = ".tmp";
+
+namespace {
+  /// Record header: identifier, payload size, CRC32 of payload
+  struct RecordHeader {
+    uint32_t id;
+    uint32_t size;
+    uint32_t crc;
+  };
+
+  const size_t kHeaderSize = sizeof(uint32_t) * 3;
+
+  uint32_t crc32(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  void encodeHeader(const RecordHeader &header, uint8_t *dest) {
+    std::memcpy(dest, &header.id, sizeof(uint32_t));
+    std::memcpy(dest + sizeof(uint32_t), &header.size, sizeof(uint32_t));
+    std::memcpy(dest + 2 * sizeof(uint32_t), &header.crc, sizeof(uint32_t));
+  }
+
+  /// Read exactly size bytes at offset
+  bool readAt(int fd, uint8_t *dest, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto read = ::pread(fd, dest, size, offset);
+      if (read <= 0) {
+        return false;
+      }
+      dest += read;
+      size -= read;
+      offset += read;
+    }
+    return true;
+  }
+
+  /// Write exactly size bytes at the end of file
+  bool writeAll(int fd, const uint8_t *src, size_t size) {
+    while (size > 0) {
+      auto written = ::write(fd, src, size);
+      if (written < 0) {
+        return false;
+      }
+      src += written;
+      size -= written;
+    }
+    return true;
+  }
+
+  RecordHeader decodeHeader(const uint8_t *src) {
+    RecordHeader header;
+    std::memcpy(&header.id, src, sizeof(uint32_t));
+    std::memcpy(&header.size, src + sizeof(uint32_t), sizeof(uint32_t));
+    std::memcpy(&header.crc, src + 2 * sizeof(uint32_t), sizeof(uint32_t));
+    return header;
+  }
+
+  boost::optional<RecordHeader> readHeader(int fd, uint64_t offset) {
+    uint8_t buf[kHeaderSize];
+    if (not readAt(fd, buf, kHeaderSize, offset)) {
+      return boost::none;
+    }
+    return decodeHeader(buf);
+  }
+
+  std::string indexPath(const std::string &segment_path) {
+    return boost::filesystem::path(segment_path)
+        .replace_extension(SegmentedLog::kIndexExtension)
+        .string();
+  }
+
+  /**
+   * Load sparse index saved for a sealed segment
+   * @return segment if index exists and matches the segment file
+   */
+  boost::optional<Segment> loadIndex(const std::string &segment_path,
+                                     Identifier first_id,
+                                     uint64_t file_size) {
+    boost::filesystem::ifstream file(indexPath(segment_path),
+                                     std::ifstream::binary);
+    if (not file.is_open()) {
+      return boost::none;
+    }
+    Segment segment{segment_path, first_id, 0, 0, {}};
+    uint64_t index_size = 0;
+    file.read(reinterpret_cast<char *>(&segment.count),
+              sizeof(segment.count));
+    file.read(reinterpret_cast<char *>(&segment.size), sizeof(segment.size));
+    file.read(reinterpret_cast<char *>(&index_size), sizeof(index_size));
+    if (not file or segment.size != file_size
+        or index_size
+            != (segment.count + SegmentedLog::kIndexInterval - 1)
+                / SegmentedLog::kIndexInterval) {
+      return boost::none;
+    }
+    segment.index.resize(index_size);
+    file.read(reinterpret_cast<char *>(segment.index.data()),
+              index_size * sizeof(uint64_t));
+    if (not file) {
+      return boost::none;
+    }
+    return segment;
+  }
+
+  bool saveIndex(const Segment &segment) {
+    auto path = indexPath(segment.path);
+    auto tmp_path = path + SegmentedLog::kTmpExtension;
+    {
+      boost::filesystem::ofstream file(tmp_path, std::ofstream::binary);
+      if (not file.is_open()) {
+        return false;
+      }
+      uint64_t index_size = segment.index.size();
+      file.write(reinterpret_cast<const char *>(&segment.count),
+                 sizeof(segment.count));
+      file.write(reinterpret_cast<const char *>(&segment.size),
+                 sizeof(segment.size));
+      file.write(reinterpret_cast<const char *>(&index_size),
+                 sizeof(index_size));
+      file.write(reinterpret_cast<const char *>(segment.index.data()),
+                 index_size * sizeof(uint64_t));
+      if (not file) {
+        return false;
+      }
+    }
+    boost::system::error_code err;
+    boost::filesystem::rename(tmp_path, path, err);
+    return not err;
+  }
+
+  /**
+   * Scan records of a segment, verifying their checksums, and build its
+   * sparse index. Scanning stops at the first incomplete or corrupted record
+   * @return scanned segment, its size is the end of the last valid record
+   */
+  boost::optional<Segment> scanSegment(const std::string &segment_path,
+                                       Identifier first_id,
+                                       uint64_t file_size) {
+    int fd = ::open(segment_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return boost::none;
+    }
+    Segment segment{segment_path, first_id, 0, 0, {}};
+    SegmentedLog::Bytes payload;
+    while (segment.size + kHeaderSize <= file_size) {
+      auto header = readHeader(fd, segment.size);
+      if (not header or header->id != first_id + segment.count
+          or segment.size + kHeaderSize + header->size > file_size) {
+        break;
+      }
+      payload.resize(header->size);
+      if (not readAt(fd,
+                     payload.data(),
+                     payload.size(),
+                     segment.size + kHeaderSize)
+          or crc32(payload.data(), payload.size()) != header->crc) {
+        break;
+      }
+      if (segment.count % SegmentedLog::kIndexInterval == 0) {
+        segment.index.push_back(segment.size);
+      }
+      ++segment.count;
+      segment.size += kHeaderSize + header->size;
+    }
+    ::close(fd);
+    return segment;
+  }
+}  // namespace
+
+boost::optional<std::unique_ptr<SegmentedLog>> SegmentedLog::create(
+    const std::string &path,
+    size_t sync_interval,
+    uint64_t segment_size,
+    logger::LoggerPtr log) {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directory(path, err)) {
+    log->error("Cannot create storage dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+
+  std::vector<std::pair<Identifier, std::string>> segment_files;
+  boost::filesystem::directory_iterator it{path, err}, end;
+  for (; not err and it != end; it.increment(err)) {
+    auto extension = it->path().extension();
+    if (extension == kIndexExtension or extension == kTmpExtension) {
+      continue;
+    }
+    boost::optional<Identifier> id;
+    if (extension == kSegmentExtension) {
+      id = FlatFile::name_to_id(it->path().stem().string());
+    }
+    if (not id) {
+      // e.g. blocks of a flat file store, which must not be read as an
+      // empty log
+      log->error("Storage dir {} contains a foreign file {}",
+                 path,
+                 it->path().string());
+      return boost::none;
+    }
+    segment_files.emplace_back(*id, it->path().string());
+  }
+  if (err) {
+    log->error("Cannot list storage dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+  std::sort(segment_files.begin(), segment_files.end());
+
+  std::vector<Segment> segments;
+  for (size_t i = 0; i < segment_files.size(); ++i) {
+    const auto &segment_path = segment_files[i].second;
+    auto first_id = segment_files[i].first;
+    auto file_size = boost::filesystem::file_size(segment_path, err);
+    if (err) {
+      log->error("Cannot get size of {}: {}", segment_path, err.message());
+      return boost::none;
+    }
+
+    bool is_last = i + 1 == segment_files.size();
+    auto segment = is_last ? boost::none
+                           : loadIndex(segment_path, first_id, file_size);
+    if (not segment) {
+      segment = scanSegment(segment_path, first_id, file_size);
+    }
+    if (not segment) {
+      log->error("Cannot read segment {}", segment_path);
+      return boost::none;
+    }
+    if (not segments.empty()
+        and segments.back().first_id + segments.back().count != first_id) {
+      log->error("Segment {} does not follow the previous one", segment_path);
+      return boost::none;
+    }
+    if (segment->size != file_size) {
+      if (not is_last) {
+        log->error("Segment {} is corrupted at offset {}",
+                   segment_path,
+                   segment->size);
+        return boost::none;
+      }
+      log->warn("Truncating incomplete records of {} from offset {}",
+                segment_path,
+                segment->size);
+      boost::filesystem::resize_file(segment_path, segment->size, err);
+      if (err) {
+        log->error("Cannot truncate {}: {}", segment_path, err.message());
+        return boost::none;
+      }
+    }
+    if (not is_last) {
+      saveIndex(*segment);
+    }
+    if (segment->count > 0) {
+      segments.push_back(std::move(*segment));
+    } else {
+      boost::filesystem::remove(segment_path, err);
+    }
+  }
+
+  return std::make_unique<SegmentedLog>(path,
+                                        std::move(segments),
+                                        sync_interval,
+                                        segment_size,
+                                        private_tag{},
+                                        std::move(log));
+}
+
+bool SegmentedLog::add(Identifier id, const Bytes &blob) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (not segments_.empty()) {
+    const auto &last = segments_.back();
+    if (id != last.first_id + last.count) {
+      log_->warn("insertion for {} failed, expected identifier {}",
+                 id,
+                 last.first_id + last.count);
+      return false;
+    }
+  }
+
+  if (active_fd_ < 0 or segments_.back().size >= segment_size_) {
+    sealActiveSegment();
+    if (not startSegment(id)) {
+      return false;
+    }
+  }
+
+  auto &segment = segments_.back();
+  Bytes record(kHeaderSize + blob.size());
+  encodeHeader(RecordHeader{id,
+                            static_cast<uint32_t>(blob.size()),
+                            crc32(blob.data(), blob.size())},
+               record.data());
+  std::copy(blob.begin(), blob.end(), record.begin() + kHeaderSize);
+  if (not writeAll(active_fd_, record.data(), record.size())) {
+    log_->warn("Cannot write record {}: {}", id, std::strerror(errno));
+    if (::ftruncate(active_fd_, segment.size) != 0
+        or ::lseek(active_fd_, segment.size, SEEK_SET) < 0) {
+      log_->error("Cannot restore segment {}", segment.path);
+    }
+    return false;
+  }
+
+  if (segment.count % kIndexInterval == 0) {
+    segment.index.push_back(segment.size);
+  }
+  ++segment.count;
+  segment.size += record.size();
+
+  if (sync_interval_ > 0 and ++unsynced_records_ >= sync_interval_) {
+    sync();
+  }
+  return true;
+}
+
+boost::optional<SegmentedLog::Bytes> SegmentedLog::get(Identifier id) const {
+  return getMapped(id) | [](const auto &record) {
+    return boost::make_optional(Bytes(record.data, record.data + record.size));
+  };
+}
+
+boost::optional<SegmentedLog::MappedRecord> SegmentedLog::getMapped(
+    Identifier id) const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = std::upper_bound(
+      segments_.begin(),
+      segments_.end(),
+      id,
+      [](Identifier id, const Segment &s) { return id < s.first_id; });
+  if (it == segments_.begin() or id - std::prev(it)->first_id
+          >= std::prev(it)->count) {
+    log_->info("get({}) record not found", id);
+    return boost::none;
+  }
+  const auto &segment = *std::prev(it);
+  if (not mapSegment(segment)) {
+    return boost::none;
+  }
+  auto mapping = segment.mapping;
+  // the mapping may extend beyond the written part of the segment
+  auto end = segment.size;
+  auto offset = segment.index[(id - segment.first_id) / kIndexInterval];
+  lock.unlock();
+
+  auto base = static_cast<const uint8_t *>(mapping.get());
+  while (offset + kHeaderSize <= end) {
+    auto header = decodeHeader(base + offset);
+    auto data = base + offset + kHeaderSize;
+    if (header.id == id) {
+      if (offset + kHeaderSize + header.size > end
+          or crc32(data, header.size) != header.crc) {
+        log_->error("get({}) record is corrupted", id);
+        return boost::none;
+      }
+      return MappedRecord{std::move(mapping), data, header.size};
+    }
+    offset += kHeaderSize + header.size;
+  }
+  log_->error("get({}) record is missing in segment", id);
+  return boost::none;
+}
+
+std::string SegmentedLog::directory() const {
+  return dump_dir_;
+}
+
+Identifier SegmentedLog::last_id() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return segments_.empty()
+      ? 0
+      : segments_.back().first_id + segments_.back().count - 1;
+}
+
+size_t SegmentedLog::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t result = 0;
+  for (const auto &segment : segments_) {
+    result += segment.count;
+  }
+  return result;
+}
+
+void SegmentedLog::forEachId(
+    const std::function<void(Identifier)> &function) const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (segments_.empty()) {
+    return;
+  }
+  auto first = segments_.front().first_id;
+  auto last = segments_.back().first_id + segments_.back().count - 1;
+  lock.unlock();
+  for (auto id = first; id <= last; ++id) {
+    function(id);
+  }
+}
+
+void SegmentedLog::dropAll() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (active_fd_ >= 0) {
+    ::close(active_fd_);
+    active_fd_ = -1;
+  }
+  iroha::remove_dir_contents(dump_dir_, log_);
+  segments_.clear();
+  unsynced_records_ = 0;
+}
+
+SegmentedLog::~SegmentedLog() {
+  if (active_fd_ >= 0) {
+    sync();
+    ::close(active_fd_);
+  }
+}
+
+SegmentedLog::SegmentedLog(std::string path,
+                           std::vector<Segment> segments,
+                           size_t sync_interval,
+                           uint64_t segment_size,
+                           SegmentedLog::private_tag,
+                           logger::LoggerPtr log)
+    : dump_dir_(std::move(path)),
+      segments_(std::move(segments)),
+      active_fd_(-1),
+      sync_interval_(sync_interval),
+      unsynced_records_(0),
+      segment_size_(segment_size),
+      log_{std::move(log)} {
+  if (not segments_.empty()) {
+    active_fd_ = ::open(segments_.back().path.c_str(), O_WRONLY | O_APPEND);
+    if (active_fd_ < 0) {
+      log_->error("Cannot open segment {} for appending",
+                  segments_.back().path);
+    }
+  }
+}
+
+bool SegmentedLog::mapSegment(const Segment &segment) const {
+  if (segment.mapped_size >= segment.size) {
+    return true;
+  }
+  int fd = ::open(segment.path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    log_->error(
+        "Cannot open segment {}: {}", segment.path, std::strerror(errno));
+    return false;
+  }
+  // the mapping is reserved up to the segment capacity, so that appended
+  // records are readable through it without remapping, and grows
+  // geometrically for segments which exceed the capacity
+  auto size = std::max({segment.size, segment_size_, 2 * segment.mapped_size});
+  auto address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    log_->error(
+        "Cannot map segment {}: {}", segment.path, std::strerror(errno));
+    return false;
+  }
+  // previous mapping is released when the last record referencing it is
+  segment.mapping =
+      std::shared_ptr<const void>(address, [size](const void *mapped) {
+        ::munmap(const_cast<void *>(mapped), size);
+      });
+  segment.mapped_size = size;
+  return true;
+}
+
+void SegmentedLog::sealActiveSegment() {
+  if (active_fd_ < 0) {
+    return;
+  }
+  sync();
+  ::close(active_fd_);
+  active_fd_ = -1;
+  if (not saveIndex(segments_.back())) {
+    log_->warn("Cannot save index of segment {}", segments_.back().path);
+  }
+}
+
+bool SegmentedLog::startSegment(Identifier id) {
+  auto path = (boost::filesystem::path{dump_dir_}
+               / (FlatFile::id_to_name(id) + kSegmentExtension))
+                  .string();
+  active_fd_ =
+      ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_EXCL, 0644);
+  if (active_fd_ < 0) {
+    log_->warn("Cannot create segment {}: {}", path, std::strerror(errno));
+    return false;
+  }
+  segments_.push_back(Segment{std::move(path), id, 0, 0, {}});
+  return true;
+}
+
+void SegmentedLog::sync() {
+  if (active_fd_ >= 0 and ::fdatasync(active_fd_) != 0) {
+    log_->error("Cannot sync segment {}: {}",
+                segments_.back().path,
+                std::strerror(errno));
+  }
+  unsynced_records_ = 0;
+}
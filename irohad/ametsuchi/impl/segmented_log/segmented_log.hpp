@@ -0,0 +1,168 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_LOG_HPP
+#define IROHA_SEGMENTED_LOG_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <memory>
+#include <mutex>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Append-only storage which keeps records in large segment files.
+     *
+     * Each record consists of a header with identifier, payload size and
+     * CRC32 of the payload followed by the payload. Identifiers must be added
+     * in consecutive order. Location of every kIndexInterval-th record is kept
+     * in a sparse in-memory index, which is saved next to a segment when it is
+     * sealed, so that startup does not need to scan all records. Incomplete or
+     * corrupted records at the end of the last segment are truncated on
+     * startup. Segments are read through memory mapping, so records could be
+     * accessed without copying.
+     */
+    class SegmentedLog : public KeyValueStorage {
+      /**
+       * Private tag used to construct unique and shared pointers
+       * without new operator
+       */
+      struct private_tag {};
+
+     public:
+      /// Default maximal size of a segment file in bytes
+      static const uint64_t kDefaultSegmentSize = 256 * 1024 * 1024;
+
+      /// Number of records between entries of the sparse index
+      static const uint32_t kIndexInterval = 64;
+
+      /// Extension of segment files
+      static const char *kSegmentExtension;
+
+      /// Extension of sparse index files of sealed segments
+      static const char *kIndexExtension;
+
+      /// Extension of index files which are being written
+      static const char *kTmpExtension;
+
+      /**
+       * Create storage in path
+       * @param path - target path for creating
+       * @param sync_interval - number of added records after which the
+       * segment is flushed to disk with fsync. 0 leaves flushing to the OS
+       * @param segment_size - size of a segment after which a new one is
+       * started
+       * @param log - logger
+       * @return created storage
+       */
+      static boost::optional<std::unique_ptr<SegmentedLog>> create(
+          const std::string &path,
+          size_t sync_interval,
+          uint64_t segment_size,
+          logger::LoggerPtr log);
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      /// Record payload in a memory mapped segment
+      struct MappedRecord {
+        /// keeps the segment mapped while the record is used
+        std::shared_ptr<const void> mapping;
+        const uint8_t *data;
+        size_t size;
+      };
+
+      /**
+       * Get record without copying it from memory mapped segment
+       * @param id - reference key
+       * @return record, if exists and is not corrupted
+       */
+      boost::optional<MappedRecord> getMapped(Identifier id) const;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      size_t size() const override;
+
+      void forEachId(
+          const std::function<void(Identifier)> &function) const override;
+
+      void dropAll() override;
+
+      SegmentedLog(const SegmentedLog &rhs) = delete;
+
+      SegmentedLog(SegmentedLog &&rhs) = delete;
+
+      SegmentedLog &operator=(const SegmentedLog &rhs) = delete;
+
+      SegmentedLog &operator=(SegmentedLog &&rhs) = delete;
+
+      ~SegmentedLog() override;
+
+      /// Segment file with its sparse index
+      struct Segment {
+        std::string path;
+        Identifier first_id;
+        uint32_t count;
+        uint64_t size;
+        /// offsets of records first_id + k * kIndexInterval
+        std::vector<uint64_t> index;
+        /// read-only mapping of the first mapped_size bytes of the segment,
+        /// which may exceed its size, and is extended lazily when the
+        /// segment outgrows it
+        mutable std::shared_ptr<const void> mapping{};
+        mutable uint64_t mapped_size = 0;
+      };
+
+      SegmentedLog(std::string path,
+                   std::vector<Segment> segments,
+                   size_t sync_interval,
+                   uint64_t segment_size,
+                   SegmentedLog::private_tag,
+                   logger::LoggerPtr log);
+
+     private:
+      /**
+       * Map the whole segment into memory unless it is already mapped, with
+       * room for records appended later
+       * @return true on success
+       */
+      bool mapSegment(const Segment &segment) const;
+
+      /// Flush and close the active segment, save its index
+      void sealActiveSegment();
+
+      /// Open a new active segment starting with id
+      bool startSegment(Identifier id);
+
+      /// Flush the active segment to disk
+      void sync();
+
+      const std::string dump_dir_;
+
+      std::vector<Segment> segments_;
+
+      /// descriptor of the last segment opened for appending, -1 if none
+      int active_fd_;
+
+      size_t sync_interval_;
+      size_t unsynced_records_;
+
+      uint64_t segment_size_;
+
+      mutable std::mutex mutex_;
+
+      logger::LoggerPtr log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_LOG_HPP
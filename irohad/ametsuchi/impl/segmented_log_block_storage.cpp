@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log_block_storage.hpp"
+
+#include "backend/protobuf/block.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+SegmentedLogBlockStorage::SegmentedLogBlockStorage(
+    std::unique_ptr<SegmentedLog> segmented_log,
+    std::shared_ptr<BlockTransportFactory> block_factory,
+    logger::LoggerPtr log)
+    : segmented_log_(std::move(segmented_log)),
+      block_factory_(std::move(block_factory)),
+      log_(std::move(log)) {}
+
+bool SegmentedLogBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  return segmented_log_->add(block->height(), block->blob().blob());
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+SegmentedLogBlockStorage::fetch(
+    shared_model::interface::types::HeightType height) const {
+  auto record = segmented_log_->getMapped(height);
+  if (not record) {
+    return boost::none;
+  }
+
+  iroha::protocol::Block block;
+  if (not block.mutable_block_v1()->ParseFromArray(
+          record->data, static_cast<int>(record->size))) {
+    log_->warn("Could not parse block at height {}", height);
+    return boost::none;
+  }
+  return block_factory_->createBlock(std::move(block))
+      .match(
+          [&](auto &&v) {
+            return boost::make_optional(
+                std::shared_ptr<const shared_model::interface::Block>(
+                    std::move(v.value)));
+          },
+          [&](const auto &e)
+              -> boost::optional<
+                  std::shared_ptr<const shared_model::interface::Block>> {
+            log_->warn(
+                "Could not build block at height {}: {}", height, e.error);
+            return boost::none;
+          });
+}
+
+size_t SegmentedLogBlockStorage::size() const {
+  return segmented_log_->size();
+}
+
+void SegmentedLogBlockStorage::clear() {
+  segmented_log_->dropAll();
+}
+
+void SegmentedLogBlockStorage::forEach(
+    iroha::ametsuchi::BlockStorage::FunctionType function) const {
+  segmented_log_->forEachId([this, &function](auto height) {
+    auto block = this->fetch(height);
+    BOOST_ASSERT(block);
+    function(*block);
+  });
+}
@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_LOG_BLOCK_STORAGE_HPP
+#define IROHA_SEGMENTED_LOG_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block storage which keeps serialized protobuf blocks in segmented log.
+     * Blocks are parsed straight from memory mapped segments
+     */
+    class SegmentedLogBlockStorage : public BlockStorage {
+     public:
+      using BlockTransportFactory = shared_model::proto::ProtoBlockFactory;
+
+      SegmentedLogBlockStorage(
+          std::unique_ptr<SegmentedLog> segmented_log,
+          std::shared_ptr<BlockTransportFactory> block_factory,
+          logger::LoggerPtr log);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+     private:
+      std::unique_ptr<SegmentedLog> segmented_log_;
+      std::shared_ptr<BlockTransportFactory> block_factory_;
+      logger::LoggerPtr log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_LOG_BLOCK_STORAGE_HPP
@@ -12,6 +12,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
+#include "ametsuchi/impl/connection_pool_monitor.hpp"
+#include "ametsuchi/impl/failover_callback_holder.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -24,6 +26,7 @@
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/prepared_statements.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "backend/protobuf/permissions.hpp"
@@ -40,6 +43,8 @@ namespace iroha {
     const char *kCommandExecutorError = "Cannot create CommandExecutorFactory";
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
+    /// time during which a fetched height of the replica is trusted
+    const std::chrono::milliseconds kReplicaHeightTtl{100};
 
     StorageImpl::StorageImpl(
         boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state,
@@ -71,7 +76,11 @@ namespace iroha {
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options_->preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          ledger_state_(std::move(ledger_state)),
+          committed_height_(
+              ledger_state_ ? ledger_state_.value()->top_block_info.height
+                            : 0),
+          replica_watermark_(kReplicaHeightTtl) {}
 
     std::unique_ptr<TemporaryWsv> StorageImpl::createTemporaryWsv(
         std::shared_ptr<CommandExecutor> command_executor) {
@@ -125,20 +134,103 @@ namespace iroha {
             "createQueryExecutor: connection to database is not initialised");
         return boost::none;
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
-      auto log_manager = log_manager_->getChild("QueryExecutor");
+      if (not pool_wrapper_->query_connection_pool_) {
+        auto sql = std::make_unique<soci::session>(*connection_);
+        return boost::make_optional<std::shared_ptr<QueryExecutor>>(
+            makeQueryExecutor(std::move(sql),
+                              std::move(pending_txs_storage),
+                              std::move(response_factory)));
+      }
+
+      // the session is taken only when a connection is free, so that a
+      // query waits no longer than the lease timeout
+      std::shared_ptr<ConnectionPoolMonitor::Lease> lease =
+          pool_wrapper_->query_pool_monitor_->acquire();
+      if (not lease) {
+        log_->warn("createQueryExecutor: no free query connection");
+        return boost::none;
+      }
+      auto sql = std::make_unique<soci::session>(
+          *pool_wrapper_->query_connection_pool_);
+      if (pool_wrapper_->primary_query_connection_pool_
+          and not replicaCaughtUp(*sql)) {
+        // the lagging replica is bypassed rather than waited for
+        log_->debug("createQueryExecutor: replica is behind, using primary");
+        sql.reset();
+        lease.reset();
+        lease = pool_wrapper_->primary_query_pool_monitor_->acquire();
+        if (not lease) {
+          log_->warn("createQueryExecutor: no free primary query connection");
+          return boost::none;
+        }
+        sql = std::make_unique<soci::session>(
+            *pool_wrapper_->primary_query_connection_pool_);
+      }
+      auto executor = makeQueryExecutor(std::move(sql),
+                                        std::move(pending_txs_storage),
+                                        std::move(response_factory));
+      // the lease is given back after the executor returns its session
       return boost::make_optional<std::shared_ptr<QueryExecutor>>(
-          std::make_shared<PostgresQueryExecutor>(
-              std::move(sql),
+          std::shared_ptr<QueryExecutor>(
+              executor.get(),
+              [executor, lease](QueryExecutor *) mutable {
+                executor.reset();
+                lease.reset();
+              }));
+    }
+
+    std::shared_ptr<QueryExecutor> StorageImpl::makeQueryExecutor(
+        std::unique_ptr<soci::session> sql,
+        std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
+        std::shared_ptr<shared_model::interface::QueryResponseFactory>
+            response_factory) const {
+      auto log_manager = log_manager_->getChild("QueryExecutor");
+      auto statements = getQueryStatements(*sql);
+      auto &session = *sql;
+      return std::make_shared<PostgresQueryExecutor>(
+          std::move(sql),
+          response_factory,
+          std::make_shared<PostgresSpecificQueryExecutor>(
+              session,
+              std::move(statements),
+              *block_store_,
+              std::move(pending_txs_storage),
               response_factory,
-              std::make_shared<PostgresSpecificQueryExecutor>(
-                  *sql,
-                  *block_store_,
-                  std::move(pending_txs_storage),
-                  response_factory,
-                  perm_converter_,
-                  log_manager->getChild("SpecificQueryExecutor")->getLogger()),
-              log_manager->getLogger()));
+              perm_converter_,
+              log_manager->getChild("SpecificQueryExecutor")->getLogger()),
+          log_manager->getLogger());
+    }
+
+    std::shared_ptr<PreparedStatements> StorageImpl::getQueryStatements(
+        soci::session &session) const {
+      // a reconnected session keeps its backend, but the statements prepared
+      // on the old connection are gone. Only the entry of the leased session
+      // is replaced, since statements are released on their own connection
+      auto generation =
+          pool_wrapper_->failover_callback_holder_->reconnections();
+      std::lock_guard<std::mutex> lock(query_statements_mutex_);
+      auto &entry = query_statements_[session.get_backend()];
+      if (not entry.second or entry.first != generation) {
+        entry = std::make_pair(generation,
+                               std::make_shared<PreparedStatements>());
+      }
+      return entry.second;
+    }
+
+    bool StorageImpl::replicaCaughtUp(soci::session &sql) const {
+      return replica_watermark_.caughtUp(
+          committed_height_.load(),
+          [&]() -> boost::optional<shared_model::interface::types::HeightType> {
+            try {
+              boost::optional<shared_model::interface::types::HeightType>
+                  height;
+              sql << "SELECT height FROM top_block_info", soci::into(height);
+              return height;
+            } catch (const std::exception &e) {
+              log_->warn("Failed to get replica height: {}", e.what());
+              return boost::none;
+            }
+          });
     }
 
     bool StorageImpl::insertBlock(
@@ -258,14 +350,41 @@ namespace iroha {
         soci::session sql(*connection_);
         tryRollback(sql);
       }
+      auto &query_connection = pool_wrapper_->query_connection_pool_;
+      auto &primary_query_connection =
+          pool_wrapper_->primary_query_connection_pool_;
       std::vector<std::shared_ptr<soci::session>> sessions;
       for (size_t i = 0; i < pool_size_; i++) {
         sessions.push_back(std::make_shared<soci::session>(*connection_));
+      }
+      std::vector<std::shared_ptr<soci::session>> query_sessions;
+      for (auto pool : {query_connection, primary_query_connection}) {
+        if (not pool) {
+          continue;
+        }
+        for (size_t i = 0; i < pool_wrapper_->query_pool_size_; i++) {
+          query_sessions.push_back(std::make_shared<soci::session>(*pool));
+        }
+      }
+      // all connections are leased, so no query executor uses the statements,
+      // which must be deallocated while the connections are still open
+      {
+        std::lock_guard<std::mutex> lock(query_statements_mutex_);
+        query_statements_.clear();
+      }
+      for (size_t i = 0; i < pool_size_; i++) {
         sessions.at(i)->close();
         log_->debug("Closed connection {}", i);
       }
+      for (size_t i = 0; i < query_sessions.size(); i++) {
+        query_sessions.at(i)->close();
+        log_->debug("Closed query connection {}", i);
+      }
       sessions.clear();
+      query_sessions.clear();
       connection_.reset();
+      query_connection.reset();
+      primary_query_connection.reset();
     }
 
     expected::Result<std::shared_ptr<StorageImpl>, std::string>
@@ -366,6 +485,7 @@ namespace iroha {
 
       ledger_state_ = storage->getLedgerState();
       if (ledger_state_) {
+        committed_height_ = ledger_state_.value()->top_block_info.height;
         return expected::makeValue(ledger_state_.value());
       } else {
         return expected::makeError(
@@ -421,6 +541,7 @@ namespace iroha {
 
           ledger_state_ = std::make_shared<const LedgerState>(
               std::move(*opt_ledger_peers), block->height(), block->hash());
+          committed_height_ = block->height();
           return expected::makeValue(ledger_state_.value());
         };
       } catch (const std::exception &e) {
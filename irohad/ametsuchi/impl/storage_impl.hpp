@@ -9,7 +9,10 @@
 #include "ametsuchi/storage.hpp"
 
 #include <atomic>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
+#include <utility>
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
@@ -17,6 +20,7 @@
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/replica_watermark.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
@@ -36,6 +40,9 @@ namespace iroha {
   class PendingTransactionStorage;
 
   namespace ametsuchi {
+
+    class PreparedStatements;
+
     class StorageImpl : public Storage {
      public:
       static expected::Result<std::shared_ptr<StorageImpl>, std::string> create(
@@ -146,6 +153,30 @@ namespace iroha {
        */
       void tryRollback(soci::session &session);
 
+      /// Create query executor which uses the given session
+      std::shared_ptr<QueryExecutor> makeQueryExecutor(
+          std::unique_ptr<soci::session> sql,
+          std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
+          std::shared_ptr<shared_model::interface::QueryResponseFactory>
+              response_factory) const;
+
+      /**
+       * Get prepared statements of query executors for the connection leased
+       * by the session. The statements are prepared anew after any pooled
+       * connection reconnects
+       */
+      std::shared_ptr<PreparedStatements> getQueryStatements(
+          soci::session &session) const;
+
+      /**
+       * Check that the replica has applied every committed block, so that a
+       * query does not miss blocks which a client may have seen committed.
+       * The replica height is fetched only once per kReplicaHeightTtl
+       * @param sql - session connected to the replica
+       * @return true if the replica is not behind the committed ledger
+       */
+      bool replicaCaughtUp(soci::session &sql) const;
+
       std::unique_ptr<BlockStorage> block_store_;
 
       std::shared_ptr<PoolWrapper> pool_wrapper_;
@@ -173,6 +204,14 @@ namespace iroha {
 
       mutable std::shared_timed_mutex drop_mutex_;
 
+      /// prepared statements of query executors per pooled connection, along
+      /// with the number of reconnections at the moment they were created
+      mutable std::unordered_map<
+          soci::session_backend *,
+          std::pair<size_t, std::shared_ptr<PreparedStatements>>>
+          query_statements_;
+      mutable std::mutex query_statements_mutex_;
+
       const size_t pool_size_;
 
       bool prepared_blocks_enabled_;
@@ -182,6 +221,13 @@ namespace iroha {
       std::string prepared_block_name_;
 
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      /// height of the last committed block, read by query threads
+      std::atomic<shared_model::interface::types::HeightType>
+          committed_height_;
+
+      /// caches the height of the replica serving queries, if there is one
+      mutable ReplicaWatermark replica_watermark_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
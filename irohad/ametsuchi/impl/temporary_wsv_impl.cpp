@@ -5,12 +5,15 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
-#include <boost/format.hpp>
-#include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/tx_executor.hpp"
+#include "common/visitor.hpp"
 #include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_signatory.hpp"
 #include "interfaces/commands/command.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
@@ -22,6 +25,7 @@ namespace iroha {
         std::shared_ptr<PostgresCommandExecutor> command_executor,
         logger::LoggerManagerTreePtr log_manager)
         : sql_(command_executor->getSession()),
+          signatories_version_(0),
           transaction_executor_(std::make_unique<TransactionExecutor>(
               std::move(command_executor))),
           log_manager_(std::move(log_manager)),
@@ -32,35 +36,22 @@ namespace iroha {
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
-      auto keys_range = transaction.signatures()
-          | boost::adaptors::transformed(
-                            [](const auto &s) { return s.publicKey().hex(); });
-      auto keys = std::accumulate(
-          std::next(std::begin(keys_range)),
-          std::end(keys_range),
-          keys_range.front(),
-          [](auto acc, const auto &val) { return acc + "'), ('" + val; });
-      // not using bool since it is not supported by SOCI
-      boost::optional<uint8_t> signatories_valid;
-
-      boost::format query(R"(SELECT sum(count) = :signatures_count
-                          AND sum(quorum) <= :signatures_count
-                  FROM
-                      (SELECT count(public_key)
-                      FROM ( VALUES ('%s') ) AS CTE1(public_key)
-                      WHERE public_key IN
-                          (SELECT public_key
-                          FROM account_has_signatory
-                          WHERE account_id = :account_id ) ) AS CTE2(count),
-                          (SELECT quorum
-                          FROM account
-                          WHERE account_id = :account_id) AS CTE3(quorum))");
-
+      bool signatories_valid = false;
       try {
-        auto keys_range_size = boost::size(keys_range);
-        sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
+        if (auto signatories =
+                getSignatories(transaction.creatorAccountId())) {
+          size_t signatures_count = 0;
+          signatories_valid = true;
+          for (const auto &signature : transaction.signatures()) {
+            ++signatures_count;
+            signatories_valid = signatories_valid
+                and signatories->public_keys.count(
+                        signature.publicKey().hex())
+                    > 0;
+          }
+          signatories_valid =
+              signatories_valid and signatories->quorum <= signatures_count;
+        }
       } catch (const std::exception &e) {
         auto error_str = "Transaction " + transaction.toString()
             + " failed signatures validation with db error: " + e.what();
@@ -70,7 +61,7 @@ namespace iroha {
             "signatures validation", 1, error_str, false});
       }
 
-      if (signatories_valid and *signatories_valid) {
+      if (signatories_valid) {
         return {};
       } else {
         auto error_str = "Transaction " + transaction.toString()
@@ -82,6 +73,70 @@ namespace iroha {
       }
     }
 
+    boost::optional<const TemporaryWsvImpl::AccountSignatories &>
+    TemporaryWsvImpl::getSignatories(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      auto it = signatories_.find(account_id);
+      if (it != signatories_.end()) {
+        return it->second;
+      }
+
+      boost::optional<int32_t> quorum;
+      sql_ << "SELECT quorum FROM account WHERE account_id = :account_id",
+          soci::into(quorum), soci::use(account_id);
+      if (not quorum) {
+        return boost::none;
+      }
+      AccountSignatories signatories{
+          {}, static_cast<shared_model::interface::types::QuorumType>(*quorum)};
+      soci::rowset<std::string> public_keys =
+          (sql_.prepare << "SELECT public_key FROM account_has_signatory "
+                           "WHERE account_id = :account_id",
+           soci::use(account_id));
+      signatories.public_keys.insert(public_keys.begin(), public_keys.end());
+      return signatories_.emplace(account_id, std::move(signatories))
+          .first->second;
+    }
+
+    void TemporaryWsvImpl::updateSignatories(
+        const shared_model::interface::Transaction &transaction) {
+      auto cached = [this](const auto &account_id) {
+        auto it = signatories_.find(account_id);
+        return it == signatories_.end() ? nullptr : &it->second;
+      };
+      // the version is changed even if the account is not cached, since it
+      // could be loaded with the changed signatories before a rollback
+      for (const auto &command : transaction.commands()) {
+        iroha::visit_in_place(
+            command.get(),
+            [&](const shared_model::interface::AddSignatory &c) {
+              if (auto signatories = cached(c.accountId())) {
+                signatories->public_keys.insert(c.pubkey().hex());
+              }
+              ++signatories_version_;
+            },
+            [&](const shared_model::interface::RemoveSignatory &c) {
+              if (auto signatories = cached(c.accountId())) {
+                signatories->public_keys.erase(c.pubkey().hex());
+              }
+              ++signatories_version_;
+            },
+            [&](const shared_model::interface::SetQuorum &c) {
+              if (auto signatories = cached(c.accountId())) {
+                signatories->quorum = c.newQuorum();
+              }
+              ++signatories_version_;
+            },
+            [&](const shared_model::interface::CreateAccount &c) {
+              // new accounts have the only signatory and quorum 1
+              signatories_[c.accountName() + "@" + c.domainId()] =
+                  AccountSignatories{{c.pubkey().hex()}, 1};
+              ++signatories_version_;
+            },
+            [](const auto &) {});
+      }
+    }
+
     expected::Result<void, validation::CommandError> TemporaryWsvImpl::apply(
         const shared_model::interface::Transaction &transaction) {
       auto savepoint_wrapper = createSavepoint("savepoint_temp_wsv");
@@ -102,6 +157,7 @@ namespace iroha {
         }
         // success
         savepoint->release();
+        this->updateSignatories(transaction);
         return {};
       };
     }
@@ -124,12 +180,14 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::SavepointWrapperImpl(
-        const iroha::ametsuchi::TemporaryWsvImpl &wsv,
+        iroha::ametsuchi::TemporaryWsvImpl &wsv,
         std::string savepoint_name,
         logger::LoggerPtr log)
-        : sql_{wsv.sql_},
+        : wsv_{wsv},
+          sql_{wsv.sql_},
           savepoint_name_{std::move(savepoint_name)},
           is_released_{false},
+          signatories_version_{wsv.signatories_version_},
           log_(std::move(log)) {
       sql_ << "SAVEPOINT " + savepoint_name_ + ";";
     }
@@ -142,6 +200,9 @@ namespace iroha {
       try {
         if (not is_released_) {
           sql_ << "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
+          if (wsv_.signatories_version_ != signatories_version_) {
+            wsv_.signatories_.clear();
+          }
         } else {
           sql_ << "RELEASE SAVEPOINT " + savepoint_name_ + ";";
         }
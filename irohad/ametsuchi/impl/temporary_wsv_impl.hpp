@@ -8,8 +8,12 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <soci/soci.h>
 #include "ametsuchi/command_executor.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -30,7 +34,7 @@ namespace iroha {
 
      public:
       struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
-        SavepointWrapperImpl(const TemporaryWsvImpl &wsv,
+        SavepointWrapperImpl(TemporaryWsvImpl &wsv,
                              std::string savepoint_name,
                              logger::LoggerPtr log);
 
@@ -39,9 +43,12 @@ namespace iroha {
         ~SavepointWrapperImpl() override;
 
        private:
+        TemporaryWsvImpl &wsv_;
         soci::session &sql_;
         std::string savepoint_name_;
         bool is_released_;
+        /// version of signatories cache when the savepoint was created
+        size_t signatories_version_;
         logger::LoggerPtr log_;
       };
 
@@ -58,6 +65,13 @@ namespace iroha {
       ~TemporaryWsvImpl() override;
 
      private:
+      /// Signatories and quorum of an account
+      struct AccountSignatories {
+        /// hex representations of public keys
+        std::unordered_set<std::string> public_keys;
+        shared_model::interface::types::QuorumType quorum;
+      };
+
       /**
        * Verifies whether transaction has at least quorum signatures and they
        * are a subset of creator account signatories
@@ -65,7 +79,29 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      /**
+       * Get signatories of an account from the cache, loading them from the
+       * database on a miss
+       * @return signatories, none if account does not exist
+       */
+      boost::optional<const AccountSignatories &> getSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /// Update cached signatories with commands of an applied transaction
+      void updateSignatories(
+          const shared_model::interface::Transaction &transaction);
+
       soci::session &sql_;
+
+      /// Signatories of accounts as of the current state of the transaction.
+      /// Cleared when a savepoint is rolled back after it was updated
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         AccountSignatories>
+          signatories_;
+      /// incremented on every applied change of signatories, whether the
+      /// changed account is cached or not
+      size_t signatories_version_;
+
       std::unique_ptr<TransactionExecutor> transaction_executor_;
 
       logger::LoggerManagerTreePtr log_manager_;
@@ -12,8 +12,13 @@
 
 namespace iroha {
   namespace ametsuchi {
-    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage)
-        : storage_(std::move(storage)) {}
+    TxPresenceCacheImpl::TxPresenceCacheImpl(
+        std::shared_ptr<Storage> storage,
+        size_t memory_cache_size,
+        std::shared_ptr<const TxPresenceFilter> filter)
+        : storage_(std::move(storage)),
+          memory_cache_(memory_cache_size),
+          filter_(std::move(filter)) {}
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::check(
         const shared_model::crypto::Hash &hash) const {
@@ -21,6 +26,10 @@ namespace iroha {
       if (res) {
         return *res;
       }
+      if (filter_ and not filter_->mayContain(hash)) {
+        return boost::make_optional<TxCacheStatusType>(
+            tx_cache_status_responses::Missing{hash});
+      }
       return checkInStorage(hash);
     }
 
@@ -7,15 +7,31 @@
 #define IROHA_TX_PRESENCE_CACHE_IMPL_HPP
 
 #include "ametsuchi/storage.hpp"
+#include "ametsuchi/impl/tx_presence_filter.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
+#include "cache/sharded_lru_cache.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
     class TxPresenceCacheImpl : public TxPresenceCache {
+      using MemoryCacheType =
+          cache::ShardedLruCache<shared_model::crypto::Hash,
+                                 TxCacheStatusType,
+                                 shared_model::crypto::Hash::Hasher>;
+
      public:
-      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage);
+      /**
+       * @param storage - storage to check transactions in
+       * @param memory_cache_size - maximal number of statuses kept in memory
+       * @param filter - filter of committed and rejected hashes, which
+       * answers Missing for hashes it does not contain without querying the
+       * storage. Storage is queried for every hash if not set
+       */
+      explicit TxPresenceCacheImpl(
+          std::shared_ptr<Storage> storage,
+          size_t memory_cache_size = MemoryCacheType::kDefaultCapacity,
+          std::shared_ptr<const TxPresenceFilter> filter = nullptr);
 
       boost::optional<TxCacheStatusType> check(
           const shared_model::crypto::Hash &hash) const override;
@@ -35,10 +51,8 @@ namespace iroha {
           const shared_model::crypto::Hash &hash) const;
 
       std::shared_ptr<Storage> storage_;
-      mutable cache::Cache<shared_model::crypto::Hash,
-                           TxCacheStatusType,
-                           shared_model::crypto::Hash::Hasher>
-          memory_cache_;
+      mutable MemoryCacheType memory_cache_;
+      std::shared_ptr<const TxPresenceFilter> filter_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,323 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_presence_filter.hpp"
+
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <soci/soci.h>
+#include <boost/crc.hpp>
+#include "ametsuchi/block_query.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HeightType;
+
+namespace {
+  using FilePtr = std::unique_ptr<std::FILE, decltype(&std::fclose)>;
+
+  const char kMagic[] = "IRTXPF01";
+  const size_t kMagicSize = sizeof(kMagic) - 1;
+  const char *kTmpExtension = ".tmp";
+  const size_t kBitsPerWord = 64;
+
+  /// FNV-1a, which is stable between builds unlike std::hash
+  uint64_t fnv1a(const std::vector<uint8_t> &bytes) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (auto byte : bytes) {
+      hash = (hash ^ byte) * 0x100000001b3ull;
+    }
+    return hash;
+  }
+
+  /// splitmix64 finalizer
+  uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  /// Writes values to a file and computes their checksum
+  class Writer {
+   public:
+    explicit Writer(std::FILE *file) : file_(file) {}
+
+    void bytes(const void *data, size_t size) {
+      crc_.process_bytes(data, size);
+      ok_ = ok_ and std::fwrite(data, 1, size, file_) == size;
+    }
+
+    void word(uint64_t value) {
+      bytes(&value, sizeof(value));
+    }
+
+    /// Write the checksum of all previous values
+    bool finish() {
+      uint32_t crc = crc_.checksum();
+      ok_ = ok_ and std::fwrite(&crc, 1, sizeof(crc), file_) == sizeof(crc);
+      return ok_;
+    }
+
+   private:
+    std::FILE *file_;
+    boost::crc_32_type crc_;
+    bool ok_ = true;
+  };
+
+  /// Reads values from a file and computes their checksum
+  class Reader {
+   public:
+    explicit Reader(std::FILE *file) : file_(file) {}
+
+    bool bytes(void *data, size_t size) {
+      if (std::fread(data, 1, size, file_) != size) {
+        return false;
+      }
+      crc_.process_bytes(data, size);
+      return true;
+    }
+
+    bool word(uint64_t &value) {
+      return bytes(&value, sizeof(value));
+    }
+
+    /// Check the checksum of all previous values and the end of file
+    bool finish() {
+      uint32_t crc;
+      return std::fread(&crc, 1, sizeof(crc), file_) == sizeof(crc)
+          and crc == crc_.checksum() and std::fgetc(file_) == EOF;
+    }
+
+   private:
+    std::FILE *file_;
+    boost::crc_32_type crc_;
+  };
+}  // namespace
+
+const size_t TxPresenceFilter::kMinCapacity;
+const size_t TxPresenceFilter::kBitsPerItem;
+const size_t TxPresenceFilter::kHashCount;
+
+TxPresenceFilter::TxPresenceFilter(size_t capacity)
+    : words_((std::max<size_t>(capacity, 1) * kBitsPerItem + kBitsPerWord - 1)
+             / kBitsPerWord) {}
+
+template <typename F>
+void TxPresenceFilter::forEachBit(const shared_model::crypto::Hash &hash,
+                                  F &&f) const {
+  // double hashing, two base hashes give all the bit indices
+  const auto bits = words_.size() * kBitsPerWord;
+  const auto first = fnv1a(hash.blob());
+  const auto step = mix(first) | 1;
+  for (size_t i = 0; i < kHashCount; ++i) {
+    f((first + i * step) % bits);
+  }
+}
+
+void TxPresenceFilter::insert(const shared_model::crypto::Hash &hash) {
+  forEachBit(hash, [this](uint64_t bit) {
+    words_[bit / kBitsPerWord].fetch_or(uint64_t{1} << (bit % kBitsPerWord),
+                                        std::memory_order_relaxed);
+  });
+  size_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TxPresenceFilter::insert(const shared_model::interface::Block &block) {
+  for (const auto &tx : block.transactions()) {
+    insert(tx.hash());
+  }
+  for (const auto &hash : block.rejected_transactions_hashes()) {
+    insert(hash);
+  }
+  std::lock_guard<std::mutex> lock(block_mutex_);
+  height_ = block.height();
+  top_hash_ = block.hash().hex();
+}
+
+bool TxPresenceFilter::mayContain(
+    const shared_model::crypto::Hash &hash) const {
+  bool found = true;
+  forEachBit(hash, [this, &found](uint64_t bit) {
+    found = found
+        and (words_[bit / kBitsPerWord].load(std::memory_order_relaxed)
+             & (uint64_t{1} << (bit % kBitsPerWord)));
+  });
+  return found;
+}
+
+size_t TxPresenceFilter::capacity() const {
+  return words_.size() * kBitsPerWord / kBitsPerItem;
+}
+
+size_t TxPresenceFilter::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+HeightType TxPresenceFilter::height() const {
+  std::lock_guard<std::mutex> lock(block_mutex_);
+  return height_;
+}
+
+iroha::expected::Result<void, std::string> TxPresenceFilter::catchUp(
+    BlockQuery &block_query) {
+  HeightType height;
+  std::string top_hash;
+  {
+    std::lock_guard<std::mutex> lock(block_mutex_);
+    height = height_;
+    top_hash = top_hash_;
+  }
+
+  if (height != 0) {
+    auto block = block_query.getBlock(height);
+    if (auto e = expected::resultToOptionalError(block)) {
+      return "cannot read block " + std::to_string(height) + ": "
+          + e->message;
+    }
+    if (expected::resultToOptionalValue(block).value()->hash().hex()
+        != top_hash) {
+      return "block " + std::to_string(height) + " does not match the ledger";
+    }
+  }
+
+  const auto top_height = block_query.getTopBlockHeight();
+  for (auto next = height + 1; next <= top_height; ++next) {
+    auto block = block_query.getBlock(next);
+    if (auto e = expected::resultToOptionalError(block)) {
+      return "cannot read block " + std::to_string(next) + ": " + e->message;
+    }
+    insert(*expected::resultToOptionalValue(block).value());
+  }
+  return {};
+}
+
+iroha::expected::Result<std::unique_ptr<TxPresenceFilter>, std::string>
+TxPresenceFilter::build(soci::session &sql) {
+  try {
+    // top block and hashes are read from the same snapshot
+    sql << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+
+    boost::optional<HeightType> height;
+    boost::optional<std::string> top_hash;
+    sql << "SELECT height, hash FROM top_block_info",
+        soci::into(height), soci::into(top_hash);
+
+    long long count = 0;
+    sql << "SELECT count(*) FROM tx_status_by_hash", soci::into(count);
+
+    auto filter = std::make_unique<TxPresenceFilter>(
+        std::max(kMinCapacity, static_cast<size_t>(count) * 2));
+    soci::rowset<std::string> hashes =
+        (sql.prepare << "SELECT hash FROM tx_status_by_hash");
+    for (const auto &hash : hashes) {
+      filter->insert(shared_model::crypto::Hash::fromHexString(hash));
+    }
+    sql << "ROLLBACK";
+
+    filter->height_ = height.value_or(0);
+    filter->top_hash_ = top_hash.value_or("");
+    return filter;
+  } catch (const std::exception &e) {
+    try {
+      sql << "ROLLBACK";
+    } catch (const std::exception &) {
+    }
+    return std::string{e.what()};
+  }
+}
+
+iroha::expected::Result<void, std::string> TxPresenceFilter::save(
+    const std::string &path) const {
+  HeightType height;
+  std::string top_hash;
+  {
+    std::lock_guard<std::mutex> lock(block_mutex_);
+    height = height_;
+    top_hash = top_hash_;
+  }
+
+  auto tmp_path = path + kTmpExtension;
+  FilePtr file(std::fopen(tmp_path.c_str(), "wb"), &std::fclose);
+  if (not file) {
+    return "cannot create " + tmp_path;
+  }
+  Writer writer(file.get());
+  writer.bytes(kMagic, kMagicSize);
+  writer.word(height);
+  writer.word(top_hash.size());
+  writer.bytes(top_hash.data(), top_hash.size());
+  writer.word(size());
+  writer.word(words_.size());
+  for (const auto &word : words_) {
+    writer.word(word.load(std::memory_order_relaxed));
+  }
+  if (not writer.finish() or std::fflush(file.get()) != 0
+      or ::fsync(fileno(file.get())) != 0) {
+    file.reset();
+    std::remove(tmp_path.c_str());
+    return "cannot write " + tmp_path;
+  }
+  file.reset();
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    return "cannot rename " + tmp_path + " to " + path;
+  }
+  return {};
+}
+
+iroha::expected::Result<std::unique_ptr<TxPresenceFilter>, std::string>
+TxPresenceFilter::load(const std::string &path) {
+  FilePtr file(std::fopen(path.c_str(), "rb"), &std::fclose);
+  if (not file) {
+    return "cannot open " + path;
+  }
+  Reader reader(file.get());
+  char magic[kMagicSize];
+  uint64_t height, hash_size, size, word_count;
+  if (not reader.bytes(magic, kMagicSize)
+      or std::memcmp(magic, kMagic, kMagicSize) != 0
+      or not reader.word(height) or not reader.word(hash_size)) {
+    return path + " is not a transaction presence filter";
+  }
+  // sanity limits, so a corrupted file does not cause a huge allocation
+  const uint64_t kMaxHashSize = 1024;
+  if (hash_size > kMaxHashSize) {
+    return path + " is corrupted";
+  }
+  std::string top_hash(hash_size, '\0');
+  if (not reader.bytes(&top_hash[0], hash_size) or not reader.word(size)
+      or not reader.word(word_count) or word_count == 0) {
+    return path + " is corrupted";
+  }
+  if (std::fseek(file.get(), 0, SEEK_END) != 0) {
+    return "cannot read " + path;
+  }
+  const auto file_size = static_cast<uint64_t>(std::ftell(file.get()));
+  const auto offset = kMagicSize + 4 * sizeof(uint64_t) + hash_size;
+  if (file_size != offset + word_count * sizeof(uint64_t) + sizeof(uint32_t)
+      or std::fseek(file.get(), offset, SEEK_SET) != 0) {
+    return path + " is corrupted";
+  }
+
+  auto filter = std::make_unique<TxPresenceFilter>(1);
+  filter->words_ = std::vector<std::atomic<uint64_t>>(word_count);
+  for (auto &word : filter->words_) {
+    uint64_t value;
+    if (not reader.word(value)) {
+      return path + " is corrupted";
+    }
+    word.store(value, std::memory_order_relaxed);
+  }
+  if (not reader.finish()) {
+    return "checksum mismatch of " + path;
+  }
+  filter->size_ = size;
+  filter->height_ = height;
+  filter->top_hash_ = std::move(top_hash);
+  return filter;
+}
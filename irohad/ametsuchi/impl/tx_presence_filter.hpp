@@ -0,0 +1,133 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_PRESENCE_FILTER_HPP
+#define IROHA_TX_PRESENCE_FILTER_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace soci {
+  class session;
+}  // namespace soci
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockQuery;
+
+    /**
+     * Bloom filter of hashes of committed and rejected transactions, which
+     * answers most of the presence checks of new transactions without a
+     * query to the ledger. The filter may report a hash which is missing, but
+     * never misses a hash which was added. Hashes can be added and checked
+     * concurrently. The filter remembers the last block it contains, so a
+     * snapshot stored on disk can be brought up to date with the following
+     * blocks instead of being built from the whole ledger.
+     */
+    class TxPresenceFilter {
+     public:
+      /// Minimal number of hashes the filter is sized for
+      static const size_t kMinCapacity = 1000000;
+
+      /// Number of filter bits per expected hash
+      static const size_t kBitsPerItem = 10;
+
+      /// Number of bits set for each hash
+      static const size_t kHashCount = 7;
+
+      /**
+       * @param capacity - expected number of hashes. The rate of false
+       * positives is about 1% while the filter holds fewer hashes
+       */
+      explicit TxPresenceFilter(size_t capacity);
+
+      /// Add the hash to the filter
+      void insert(const shared_model::crypto::Hash &hash);
+
+      /**
+       * Add hashes of committed and rejected transactions of the block and
+       * remember it as the last block of the filter
+       */
+      void insert(const shared_model::interface::Block &block);
+
+      /**
+       * @return false if the hash was never added, true if it probably was
+       */
+      bool mayContain(const shared_model::crypto::Hash &hash) const;
+
+      /// @return number of hashes the filter is sized for
+      size_t capacity() const;
+
+      /// @return number of added hashes
+      size_t size() const;
+
+      /// @return height of the last block of the filter, 0 for none
+      shared_model::interface::types::HeightType height() const;
+
+      /**
+       * Add transactions of blocks following the last block of the filter
+       * @param block_query - access to the ledger
+       * @return error message if the last block of the filter is not a
+       * block of the ledger, or a following block cannot be read
+       */
+      expected::Result<void, std::string> catchUp(BlockQuery &block_query);
+
+      /**
+       * Build the filter from hashes of transactions in the ledger
+       * @param sql - connection to working database
+       * @return filter containing the top block of the ledger, or error
+       * message
+       */
+      static expected::Result<std::unique_ptr<TxPresenceFilter>, std::string>
+      build(soci::session &sql);
+
+      /**
+       * Store the filter to a file, replacing it atomically
+       * @param path - path to the file
+       * @return error message if the file cannot be written
+       */
+      expected::Result<void, std::string> save(const std::string &path) const;
+
+      /**
+       * Read the filter stored by save()
+       * @param path - path to the file
+       * @return the filter or error message if the file is missing or
+       * corrupted
+       */
+      static expected::Result<std::unique_ptr<TxPresenceFilter>, std::string>
+      load(const std::string &path);
+
+     private:
+      /// Call f with index of each bit of the hash
+      template <typename F>
+      void forEachBit(const shared_model::crypto::Hash &hash, F &&f) const;
+
+      std::vector<std::atomic<uint64_t>> words_;
+      std::atomic<size_t> size_{0};
+
+      /// protects the last block, which is changed by insert(block)
+      mutable std::mutex block_mutex_;
+      shared_model::interface::types::HeightType height_ = 0;
+      std::string top_hash_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_TX_PRESENCE_FILTER_HPP
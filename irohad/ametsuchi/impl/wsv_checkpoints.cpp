@@ -0,0 +1,388 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/wsv_checkpoints.hpp"
+
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::types::HeightType;
+namespace fs = boost::filesystem;
+
+namespace {
+  using PgResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+  using FilePtr = std::unique_ptr<std::FILE, decltype(&std::fclose)>;
+
+  const char *kManifestName = "manifest";
+  const char *kTmpExtension = ".tmp";
+  const size_t kChunkSize = 64 * 1024;
+
+  /// WSV tables in the order which satisfies their foreign keys on load
+  const std::vector<std::string> kTables{"role",
+                                         "domain",
+                                         "signatory",
+                                         "account",
+                                         "account_detail",
+                                         "account_has_signatory",
+                                         "peer",
+                                         "asset",
+                                         "account_has_asset",
+                                         "role_has_permissions",
+                                         "account_has_roles",
+                                         "account_has_grantable_permissions",
+                                         "position_by_hash",
+                                         "tx_status_by_hash",
+                                         "tx_position_by_creator",
+                                         "position_by_account_asset",
+                                         "setting",
+                                         "top_block_info"};
+
+  /// Size and checksum of a copied table
+  struct TableFile {
+    std::string table;
+    uint64_t size;
+    uint32_t crc;
+  };
+
+  struct Manifest {
+    HeightType height;
+    std::string top_hash;
+    std::vector<TableFile> tables;
+  };
+
+  /// Get libpq connection which is used by soci session
+  PGconn *getConnection(soci::session &sql) {
+    return static_cast<soci::postgresql_session_backend *>(sql.get_backend())
+        ->conn_;
+  }
+
+  /// Consume the results of a finished COPY
+  std::string finishCopy(PGconn *conn, std::string error) {
+    while (auto next = PQgetResult(conn)) {
+      PgResultPtr result(next, &PQclear);
+      if (PQresultStatus(result.get()) != PGRES_COMMAND_OK and error.empty()) {
+        error = PQresultErrorMessage(result.get());
+      }
+    }
+    return error;
+  }
+
+  /// Write binary COPY of the table to the file
+  iroha::expected::Result<TableFile, std::string> copyOut(
+      PGconn *conn, const std::string &table, const fs::path &path) {
+    FilePtr file(std::fopen(path.c_str(), "wb"), &std::fclose);
+    if (not file) {
+      return "cannot create " + path.string();
+    }
+    auto query = "COPY " + table + " TO STDOUT (FORMAT binary)";
+    PgResultPtr result(PQexec(conn, query.c_str()), &PQclear);
+    if (PQresultStatus(result.get()) != PGRES_COPY_OUT) {
+      return std::string{PQresultErrorMessage(result.get())};
+    }
+
+    TableFile table_file{table, 0, 0};
+    boost::crc_32_type crc;
+    std::string error;
+    char *buffer = nullptr;
+    int size;
+    while ((size = PQgetCopyData(conn, &buffer, 0)) > 0) {
+      crc.process_bytes(buffer, size);
+      table_file.size += size;
+      if (error.empty()
+          and std::fwrite(buffer, 1, size, file.get())
+              != static_cast<size_t>(size)) {
+        error = "cannot write " + path.string();
+      }
+      PQfreemem(buffer);
+    }
+    if (size == -2 and error.empty()) {
+      error = PQerrorMessage(conn);
+    }
+    error = finishCopy(conn, std::move(error));
+    if (error.empty()
+        and (std::fflush(file.get()) != 0
+             or ::fsync(fileno(file.get())) != 0)) {
+      error = "cannot flush " + path.string();
+    }
+    if (not error.empty()) {
+      return error;
+    }
+    table_file.crc = crc.checksum();
+    return table_file;
+  }
+
+  /// Send the file to the table with binary COPY, verifying its checksum
+  iroha::expected::Result<void, std::string> copyIn(PGconn *conn,
+                                                    const TableFile &table_file,
+                                                    const fs::path &path) {
+    FilePtr file(std::fopen(path.c_str(), "rb"), &std::fclose);
+    if (not file) {
+      return "cannot open " + path.string();
+    }
+    auto query = "COPY " + table_file.table + " FROM STDIN (FORMAT binary)";
+    PgResultPtr result(PQexec(conn, query.c_str()), &PQclear);
+    if (PQresultStatus(result.get()) != PGRES_COPY_IN) {
+      return std::string{PQresultErrorMessage(result.get())};
+    }
+
+    boost::crc_32_type crc;
+    uint64_t total_size = 0;
+    std::string error;
+    std::vector<char> buffer(kChunkSize);
+    size_t size;
+    while (error.empty()
+           and (size = std::fread(buffer.data(), 1, buffer.size(), file.get()))
+               > 0) {
+      crc.process_bytes(buffer.data(), size);
+      total_size += size;
+      if (PQputCopyData(conn, buffer.data(), static_cast<int>(size)) != 1) {
+        error = PQerrorMessage(conn);
+      }
+    }
+    if (error.empty()
+        and (total_size != table_file.size
+             or crc.checksum() != table_file.crc)) {
+      error = "checksum mismatch of " + path.string();
+    }
+    // an error message passed to PQputCopyEnd aborts the COPY
+    if (PQputCopyEnd(conn, error.empty() ? nullptr : error.c_str()) != 1
+        and error.empty()) {
+      error = PQerrorMessage(conn);
+    }
+    error = finishCopy(conn, std::move(error));
+    if (not error.empty()) {
+      return error;
+    }
+    return {};
+  }
+
+  boost::optional<Manifest> readManifest(const fs::path &checkpoint_path) {
+    fs::ifstream file(checkpoint_path / kManifestName);
+    Manifest manifest;
+    std::string field;
+    if (not(file >> field) or field != "height"
+        or not(file >> manifest.height) or not(file >> field)
+        or field != "hash" or not(file >> manifest.top_hash)) {
+      return boost::none;
+    }
+    TableFile table_file;
+    while (file >> field) {
+      if (field != "table"
+          or not(file >> table_file.table >> table_file.size
+                 >> table_file.crc)) {
+        return boost::none;
+      }
+      manifest.tables.push_back(table_file);
+    }
+    return manifest;
+  }
+
+  bool writeManifest(const fs::path &checkpoint_path,
+                     const Manifest &manifest) {
+    auto path = checkpoint_path / kManifestName;
+    FilePtr file(std::fopen(path.c_str(), "w"), &std::fclose);
+    if (not file) {
+      return false;
+    }
+    bool written =
+        std::fprintf(file.get(),
+                     "height %llu\nhash %s\n",
+                     static_cast<unsigned long long>(manifest.height),
+                     manifest.top_hash.c_str())
+        > 0;
+    for (const auto &table_file : manifest.tables) {
+      written = written
+          and std::fprintf(file.get(),
+                           "table %s %llu %u\n",
+                           table_file.table.c_str(),
+                           static_cast<unsigned long long>(table_file.size),
+                           static_cast<unsigned>(table_file.crc))
+              > 0;
+    }
+    return written and std::fflush(file.get()) == 0
+        and ::fsync(fileno(file.get())) == 0;
+  }
+}  // namespace
+
+WsvCheckpoints::WsvCheckpoints(std::string path,
+                               std::string connection_string,
+                               logger::LoggerPtr log)
+    : path_(std::move(path)),
+      connection_string_(std::move(connection_string)),
+      log_(std::move(log)) {
+  boost::system::error_code err;
+  fs::create_directories(path_, err);
+  if (err) {
+    log_->error("Cannot create WSV checkpoints folder {}: {}",
+                path_,
+                err.message());
+  }
+}
+
+WsvCheckpoints::~WsvCheckpoints() {
+  std::lock_guard<std::mutex> lock(background_mutex_);
+  if (background_.valid()) {
+    background_.wait();
+  }
+}
+
+iroha::expected::Result<WsvCheckpoints::Checkpoint, std::string>
+WsvCheckpoints::create() {
+  try {
+    // the connection is closed on return, which rolls back the snapshot
+    soci::session sql(*soci::factory_postgresql(), connection_string_);
+    sql << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+
+    boost::optional<HeightType> height;
+    boost::optional<std::string> top_hash;
+    sql << "SELECT height, hash FROM top_block_info",
+        soci::into(height), soci::into(top_hash);
+    if (not height or not top_hash) {
+      return std::string{"WSV has no blocks"};
+    }
+
+    Checkpoint checkpoint{
+        *height,
+        *top_hash,
+        (fs::path(path_) / std::to_string(*height)).string()};
+    if (fs::exists(checkpoint.path)) {
+      return checkpoint;
+    }
+
+    fs::path tmp_path = checkpoint.path + kTmpExtension;
+    fs::remove_all(tmp_path);
+    fs::create_directories(tmp_path);
+
+    Manifest manifest{*height, *top_hash, {}};
+    auto conn = getConnection(sql);
+    for (const auto &table : kTables) {
+      auto table_file = copyOut(conn, table, tmp_path / table);
+      if (auto e = expected::resultToOptionalError(table_file)) {
+        fs::remove_all(tmp_path);
+        return "failed to copy " + table + ": " + *e;
+      }
+      manifest.tables.push_back(
+          std::move(expected::resultToOptionalValue(table_file).value()));
+    }
+
+    if (not writeManifest(tmp_path, manifest)) {
+      fs::remove_all(tmp_path);
+      return std::string{"cannot write manifest"};
+    }
+    fs::rename(tmp_path, checkpoint.path);
+    removeOld();
+    return checkpoint;
+  } catch (const std::exception &e) {
+    return std::string{e.what()};
+  }
+}
+
+void WsvCheckpoints::createInBackground() {
+  std::lock_guard<std::mutex> lock(background_mutex_);
+  if (background_.valid()
+      and background_.wait_for(std::chrono::seconds(0))
+          != std::future_status::ready) {
+    log_->info("Previous WSV checkpoint is not finished yet, skipping");
+    return;
+  }
+  background_ = std::async(std::launch::async, [this] {
+    auto start = std::chrono::steady_clock::now();
+    create().match(
+        [this, &start](const auto &checkpoint) {
+          log_->info("Created WSV checkpoint at height {} in {} ms",
+                     checkpoint.value.height,
+                     std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count());
+        },
+        [this](const auto &error) {
+          log_->warn("Failed to create WSV checkpoint: {}", error.error);
+        });
+  });
+}
+
+std::vector<WsvCheckpoints::Checkpoint> WsvCheckpoints::list() const {
+  std::vector<Checkpoint> checkpoints;
+  boost::system::error_code err;
+  for (fs::directory_iterator it{path_, err}, end; not err and it != end;
+       it.increment(err)) {
+    auto name = it->path().filename().string();
+    if (name.empty()
+        or not std::all_of(name.begin(), name.end(), [](char c) {
+             return std::isdigit(c);
+           })) {
+      continue;
+    }
+    if (auto manifest = readManifest(it->path())) {
+      checkpoints.push_back(Checkpoint{
+          manifest->height, manifest->top_hash, it->path().string()});
+    }
+  }
+  std::sort(checkpoints.begin(),
+            checkpoints.end(),
+            [](const auto &lhs, const auto &rhs) {
+              return lhs.height > rhs.height;
+            });
+  return checkpoints;
+}
+
+iroha::expected::Result<void, std::string> WsvCheckpoints::load(
+    const Checkpoint &checkpoint) {
+  auto manifest = readManifest(checkpoint.path);
+  if (not manifest) {
+    return std::string{"cannot read manifest"};
+  }
+  if (manifest->tables.size() != kTables.size()
+      or not std::equal(kTables.begin(),
+                        kTables.end(),
+                        manifest->tables.begin(),
+                        [](const auto &table, const auto &table_file) {
+                          return table == table_file.table;
+                        })) {
+    return std::string{"checkpoint tables do not match WSV schema"};
+  }
+
+  try {
+    // the transaction is rolled back on error when the connection is closed
+    soci::session sql(*soci::factory_postgresql(), connection_string_);
+    sql << "BEGIN";
+    auto conn = getConnection(sql);
+    for (const auto &table_file : manifest->tables) {
+      auto result = copyIn(
+          conn, table_file, fs::path(checkpoint.path) / table_file.table);
+      if (auto e = expected::resultToOptionalError(result)) {
+        return "failed to load " + table_file.table + ": " + *e;
+      }
+    }
+    sql << "COMMIT";
+  } catch (const std::exception &e) {
+    return std::string{e.what()};
+  }
+  return {};
+}
+
+void WsvCheckpoints::removeOld() {
+  auto checkpoints = list();
+  for (size_t i = kKeepCount; i < checkpoints.size(); ++i) {
+    boost::system::error_code err;
+    fs::remove_all(checkpoints[i].path, err);
+    if (err) {
+      log_->warn("Cannot remove WSV checkpoint {}: {}",
+                 checkpoints[i].path,
+                 err.message());
+    }
+  }
+}
@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_CHECKPOINTS_HPP
+#define IROHA_WSV_CHECKPOINTS_HPP
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// Options of periodic WSV checkpoints
+    struct WsvCheckpointOptions {
+      /// folder of checkpoints
+      std::string path;
+      /// number of blocks between checkpoints
+      shared_model::interface::types::HeightType interval;
+    };
+
+    /**
+     * Snapshots of WSV tables, which allow to restore WSV without replaying
+     * the whole ledger. Each checkpoint is a folder named by the height of
+     * the top block it contains, with a binary COPY of every table and a
+     * manifest, which is written last and holds the top block hash and
+     * checksums of the tables.
+     */
+    class WsvCheckpoints {
+     public:
+      /// Description of a stored checkpoint
+      struct Checkpoint {
+        /// height of the last block applied to the checkpoint
+        shared_model::interface::types::HeightType height;
+        /// hex hash of that block
+        std::string top_hash;
+        /// folder of the checkpoint
+        std::string path;
+      };
+
+      /// Default number of blocks between checkpoints
+      static const shared_model::interface::types::HeightType kDefaultInterval =
+          10000;
+
+      /// Number of newest checkpoints which are kept
+      static const size_t kKeepCount = 2;
+
+      /**
+       * @param path - folder of checkpoints, created if missing
+       * @param connection_string - connection string to working database
+       * @param log - logger
+       */
+      WsvCheckpoints(std::string path,
+                     std::string connection_string,
+                     logger::LoggerPtr log);
+
+      /// Waits for a checkpoint which is being created in background
+      ~WsvCheckpoints();
+
+      /**
+       * Create checkpoint of the current state of working database. Tables
+       * are read from a single snapshot, so the checkpoint is consistent
+       * even if blocks are committed meanwhile. Old checkpoints are removed
+       * except kKeepCount newest ones
+       * @return created checkpoint or error message
+       */
+      expected::Result<Checkpoint, std::string> create();
+
+      /// Start create() on a separate thread, unless it is already running
+      void createInBackground();
+
+      /**
+       * @return stored checkpoints with a readable manifest, newest first.
+       * Contents of the tables are verified only by load()
+       */
+      std::vector<Checkpoint> list() const;
+
+      /**
+       * Load tables of the checkpoint into empty WSV in a single transaction
+       * @param checkpoint - checkpoint from list()
+       * @return error message if the checkpoint is corrupted or does not
+       * match the schema, in which case WSV is left unchanged
+       */
+      expected::Result<void, std::string> load(const Checkpoint &checkpoint);
+
+     private:
+      /// Remove all checkpoints except kKeepCount newest ones
+      void removeOld();
+
+      const std::string path_;
+      const std::string connection_string_;
+
+      std::mutex background_mutex_;
+      std::future<void> background_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CHECKPOINTS_HPP
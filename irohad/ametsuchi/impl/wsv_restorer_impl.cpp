@@ -5,13 +5,19 @@
 
 #include "wsv_restorer_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/block_prefetcher.hpp"
+#include "ametsuchi/impl/wsv_checkpoints.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/storage.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
 
 namespace {
   /**
@@ -61,23 +67,44 @@ namespace {
     }
   };
 
+  /// Interval between progress reports of restoration
+  const std::chrono::seconds kProgressInterval{10};
+
   /**
-   * Reapply blocks from existing storage to WSV
+   * Reapply blocks from existing storage to WSV. Blocks are read and parsed
+   * ahead on several threads, while they are applied in order on this one.
    * @param storage - current storage
    * @param mutable_storage - mutable storage without blocks
    * @param block_query - current block storage
+   * @param first_height - height of the first block to apply
+   * @param top_height - height of the last block to apply
+   * @param log - logger for progress reports
    * @return commit status after applying the blocks
    */
   iroha::ametsuchi::CommitResult reindexBlocks(
       iroha::ametsuchi::Storage &storage,
       std::unique_ptr<iroha::ametsuchi::MutableStorage> &mutable_storage,
-      std::shared_ptr<iroha::ametsuchi::BlockQuery> &block_query) {
-    // apply all blocks starting from the genesis
-    auto top_height = block_query->getTopBlockHeight();
-    for (decltype(top_height) i = 1; i <= top_height; ++i) {
-      auto result = block_query->getBlock(i).match(
-          [&mutable_storage](
+      iroha::ametsuchi::BlockQuery &block_query,
+      shared_model::interface::types::HeightType first_height,
+      shared_model::interface::types::HeightType top_height,
+      const logger::LoggerPtr &log) {
+    log->info("Applying blocks {} to {}", first_height, top_height);
+    iroha::ametsuchi::BlockPrefetcher prefetcher(
+        block_query, first_height, top_height);
+    boost::optional<shared_model::interface::types::HashType> prev_hash;
+    auto start = std::chrono::steady_clock::now();
+    auto last_report = start;
+    for (auto i = first_height; i <= top_height; ++i) {
+      auto result = prefetcher.next().match(
+          [&mutable_storage, &prev_hash, i](
               auto &&block) -> iroha::expected::Result<void, std::string> {
+            if (block.value->height() != i
+                or (prev_hash and block.value->prevHash() != *prev_hash)) {
+              return iroha::expected::makeError(
+                  "Block " + std::to_string(i)
+                  + " does not follow the previous one");
+            }
+            prev_hash = block.value->hash();
             if (not mutable_storage->apply(std::move(block).value)) {
               return iroha::expected::makeError("Cannot apply block!");
             }
@@ -90,6 +117,19 @@ namespace {
       if (auto e = iroha::expected::resultToOptionalError(result)) {
         return std::move(e).value();
       }
+
+      auto now = std::chrono::steady_clock::now();
+      if (now - last_report >= kProgressInterval) {
+        last_report = now;
+        auto applied = i - first_height + 1;
+        auto seconds =
+            std::chrono::duration_cast<std::chrono::seconds>(now - start)
+                .count();
+        log->info("Applied block {} of {}, {} blocks/s",
+                  i,
+                  top_height,
+                  applied / std::max<decltype(seconds)>(seconds, 1));
+      }
     }
 
     return storage.commit(std::move(mutable_storage));
@@ -98,23 +138,72 @@ namespace {
 
 namespace iroha {
   namespace ametsuchi {
+    WsvRestorerImpl::WsvRestorerImpl(
+        logger::LoggerPtr log, std::shared_ptr<WsvCheckpoints> checkpoints)
+        : log_(std::move(log)), checkpoints_(std::move(checkpoints)) {}
+
     CommitResult WsvRestorerImpl::restoreWsv(Storage &storage) {
-      return storage.createCommandExecutor() |
-                 [&storage](auto &&command_executor) -> CommitResult {
-        BlockStorageStubFactory storage_factory;
-
-        auto mutable_storage = storage.createMutableStorage(
-            std::move(command_executor), storage_factory);
-        auto block_query = storage.getBlockQuery();
-        if (not block_query) {
-          return expected::makeError("Cannot create BlockQuery");
-        }
+      auto block_query = storage.getBlockQuery();
+      if (not block_query) {
+        return expected::makeError("Cannot create BlockQuery");
+      }
+
+      return storage.resetWsv() | [this, &storage, &block_query] {
+        auto top_height = block_query->getTopBlockHeight();
+        auto checkpoint_height = loadCheckpoint(*block_query, top_height);
 
-        return storage.resetWsv() |
-            [&storage, &mutable_storage, &block_query]() {
-              return reindexBlocks(storage, mutable_storage, block_query);
-            };
+        // blocks are applied after the checkpoint is loaded, so that the
+        // mutable storage sees its tables
+        return storage.createCommandExecutor() |
+                   [&](auto &&command_executor) -> CommitResult {
+          BlockStorageStubFactory storage_factory;
+          auto mutable_storage = storage.createMutableStorage(
+              std::move(command_executor), storage_factory);
+          return reindexBlocks(storage,
+                               mutable_storage,
+                               *block_query,
+                               checkpoint_height + 1,
+                               top_height,
+                               log_);
+        };
       };
     }
+
+    shared_model::interface::types::HeightType WsvRestorerImpl::loadCheckpoint(
+        BlockQuery &block_query,
+        shared_model::interface::types::HeightType top_height) {
+      if (not checkpoints_) {
+        return 0;
+      }
+      for (const auto &checkpoint : checkpoints_->list()) {
+        // the ledger state is built by applying at least one block
+        if (checkpoint.height >= top_height) {
+          continue;
+        }
+        auto block_matches = block_query.getBlock(checkpoint.height).match(
+            [&checkpoint](const auto &block) {
+              return block.value->hash().hex() == checkpoint.top_hash;
+            },
+            [](const auto &) { return false; });
+        if (not block_matches) {
+          log_->warn("WSV checkpoint {} does not match the ledger",
+                     checkpoint.path);
+          continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        if (auto e = expected::resultToOptionalError(
+                checkpoints_->load(checkpoint))) {
+          log_->warn("Cannot load WSV checkpoint {}: {}", checkpoint.path, *e);
+          continue;
+        }
+        log_->info("Loaded WSV checkpoint at height {} in {} ms",
+                   checkpoint.height,
+                   std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count());
+        return checkpoint.height;
+      }
+      return 0;
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
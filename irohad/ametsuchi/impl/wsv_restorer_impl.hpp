@@ -9,25 +9,54 @@
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/wsv_restorer.hpp"
 #include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
+    class BlockQuery;
+    class WsvCheckpoints;
+
     /**
      * Recover WSV (World State View).
      * @return true on success, otherwise false
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      /**
+       * @param log - logger
+       * @param checkpoints - WSV checkpoints to start restoration from. If
+       * null, all blocks are applied
+       */
+      explicit WsvRestorerImpl(
+          logger::LoggerPtr log,
+          std::shared_ptr<WsvCheckpoints> checkpoints = nullptr);
+
       virtual ~WsvRestorerImpl() = default;
       /**
        * Recover WSV (World State View).
-       * Drop storage and apply blocks one by one.
+       * Drop storage, load the latest checkpoint which matches the ledger
+       * and apply the following blocks one by one.
        * @param storage of blocks in ledger
        * @return ledger state after restoration on success, otherwise error
        * string
        */
       CommitResult restoreWsv(Storage &storage) override;
+
+     private:
+      /**
+       * Load the latest checkpoint, which is older than the top block and
+       * contains the same block as the ledger at its height
+       * @param block_query - ledger blocks
+       * @param top_height - height of the ledger
+       * @return height of the loaded checkpoint or 0 if none is loaded
+       */
+      shared_model::interface::types::HeightType loadCheckpoint(
+          BlockQuery &block_query,
+          shared_model::interface::types::HeightType top_height);
+
+      logger::LoggerPtr log_;
+      std::shared_ptr<WsvCheckpoints> checkpoints_;
     };
 
   }  // namespace ametsuchi
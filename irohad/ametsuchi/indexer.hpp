@@ -54,6 +54,11 @@ namespace iroha {
           const shared_model::interface::types::AssetIdType &asset_id,
           TxPosition position) = 0;
 
+      /// Store the height and hash of the indexed block as the top one.
+      virtual void topBlock(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash) = 0;
+
       /**
        * Flush the indices to storage.
        * Makes the effects of new indices (that were created before this call)
@@ -61,6 +66,9 @@ namespace iroha {
        * @return Void Value on success, string Error on failure.
        */
       virtual iroha::expected::Result<void, std::string> flush() = 0;
+
+      /// Drop the indices created since the last flush.
+      virtual void discard() = 0;
     };
 
   }  // namespace ametsuchi
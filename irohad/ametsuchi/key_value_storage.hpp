@@ -7,6 +7,7 @@
 #define IROHA_KV_STORAGE_HPP
 
 #include <boost/optional.hpp>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,18 @@ namespace iroha {
        */
       virtual Identifier last_id() const = 0;
 
+      /**
+       * @return number of stored entities
+       */
+      virtual size_t size() const = 0;
+
+      /**
+       * Call function for each stored key in ascending order
+       * @param function - function to call
+       */
+      virtual void forEachId(
+          const std::function<void(Identifier)> &function) const = 0;
+
       virtual void dropAll() = 0;
 
       virtual ~KeyValueStorage() = default;
@@ -18,17 +18,20 @@ namespace iroha {
           : keypair_(keypair) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
-        return std::all_of(
-            std::begin(msg), std::end(msg), [](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
-
-              return shared_model::crypto::CryptoVerifier<>::verify(
-                  vote.signature->signedData(),
-                  blob,
-                  vote.signature->publicKey());
-            });
+        std::vector<shared_model::crypto::Blob> blobs;
+        blobs.reserve(msg.size());
+        shared_model::crypto::VerificationBatch batch;
+        batch.reserve(msg.size());
+        for (const auto &vote : msg) {
+          blobs.emplace_back(
+              PbConverters::serializeVote(vote).hash().SerializeAsString());
+          batch.emplace_back(vote.signature->signedData(),
+                             blobs.back(),
+                             vote.signature->publicKey());
+        }
+
+        return shared_model::crypto::CryptoVerifier<>::verifyBatch(batch)
+            .empty();
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
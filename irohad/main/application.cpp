@@ -5,12 +5,17 @@
 
 #include "main/application.hpp"
 
+#include <thread>
+
 #include <boost/filesystem.hpp>
 #include <rxcpp/operators/rx-map.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_block_storage_factory.hpp"
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+#include "ametsuchi/impl/segmented_log_block_storage.hpp"
 #include "ametsuchi/impl/storage_impl.hpp"
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
@@ -24,6 +29,7 @@
 #include "consensus/yac/consistency_model.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
 #include "generator/generator.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/logger.hpp"
@@ -41,6 +47,7 @@
 #include "multi_sig_transactions/transport/mst_transport_stub.hpp"
 #include "network/impl/block_loader_impl.hpp"
 #include "network/impl/peer_communication_service_impl.hpp"
+#include "ordering/impl/batches_packing_policies.hpp"
 #include "ordering/impl/kick_out_proposal_creation_strategy.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
@@ -93,6 +100,17 @@ Irohad::Irohad(const boost::optional<std::string> &block_store_dir,
                const shared_model::crypto::Keypair &keypair,
                std::chrono::milliseconds max_rounds_delay,
                size_t stale_stream_max_rounds,
+               iroha::ordering::PackingPolicyType proposal_packing_policy,
+               iroha::ametsuchi::BlockStoreFormat block_store_format,
+               size_t block_store_sync_interval,
+               size_t pg_pool_size,
+               boost::optional<iroha::ametsuchi::QueryPoolOptions>
+                   pg_query_pool,
+               boost::optional<iroha::ametsuchi::WsvCheckpointOptions>
+                   wsv_checkpoints,
+               size_t tx_status_cache_size,
+               size_t tx_presence_cache_size,
+               boost::optional<std::string> tx_presence_filter_path,
                boost::optional<shared_model::interface::types::PeerList>
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr logger_manager,
@@ -111,6 +129,15 @@ Irohad::Irohad(const boost::optional<std::string> &block_store_dir,
       mst_expiration_time_(mst_expiration_time),
       max_rounds_delay_(max_rounds_delay),
       stale_stream_max_rounds_(stale_stream_max_rounds),
+      proposal_packing_policy_(proposal_packing_policy),
+      block_store_format_(block_store_format),
+      block_store_sync_interval_(block_store_sync_interval),
+      pg_pool_size_(pg_pool_size),
+      pg_query_pool_(pg_query_pool),
+      wsv_checkpoint_options_(std::move(wsv_checkpoints)),
+      tx_status_cache_size_(tx_status_cache_size),
+      tx_presence_cache_size_(tx_presence_cache_size),
+      tx_presence_filter_path_(std::move(tx_presence_filter_path)),
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
       pending_txs_storage_init(
@@ -137,6 +164,11 @@ Irohad::Irohad(const boost::optional<std::string> &block_store_dir,
 Irohad::~Irohad() {
   consensus_gate_objects_lifetime.unsubscribe();
   consensus_gate_events_subscription.unsubscribe();
+  wsv_checkpoints_subscription_.unsubscribe();
+  tx_presence_filter_subscription_.unsubscribe();
+  if (tx_presence_filter_) {
+    storeTxPresenceFilter(*tx_presence_filter_);
+  }
 }
 
 /**
@@ -241,12 +273,12 @@ Irohad::RunResult Irohad::initStorage(
     return expected::makeError(string_res.value());
   }
 
-  const int pool_size = 10;
   auto pool = PgConnectionInit::prepareConnectionPool(
       iroha::ametsuchi::KTimesReconnectionStrategyFactory{10},
       *pg_opt,
-      pool_size,
-      log_manager_);
+      pg_pool_size_,
+      log_manager_,
+      pg_query_pool_);
 
   if (auto error = resultToOptionalError(pool)) {
     return expected::makeError(std::move(*error));
@@ -254,6 +286,13 @@ Irohad::RunResult Irohad::initStorage(
 
   pool_wrapper_ = std::move(resultToOptionalValue(pool).value());
 
+  if (wsv_checkpoint_options_) {
+    wsv_checkpoints_ = std::make_shared<WsvCheckpoints>(
+        wsv_checkpoint_options_->path,
+        pg_opt->workingConnectionString(),
+        log_manager_->getChild("WsvCheckpoints")->getLogger());
+  }
+
   std::unique_ptr<BlockStorageFactory> temporary_block_storage_factory =
       std::make_unique<PostgresBlockStorageFactory>(
           pool_wrapper_,
@@ -262,7 +301,22 @@ Irohad::RunResult Irohad::initStorage(
           log_manager_->getChild("TemporaryBlockStorage")->getLogger());
 
   std::unique_ptr<BlockStorage> persistent_block_storage;
-  if (block_store_dir_) {
+  if (block_store_dir_
+      and block_store_format_ == BlockStoreFormat::kSegmentedLog) {
+    auto segmented_log = SegmentedLog::create(
+        *block_store_dir_,
+        block_store_sync_interval_,
+        SegmentedLog::kDefaultSegmentSize,
+        log_manager_->getChild("SegmentedLog")->getLogger());
+    if (not segmented_log) {
+      return expected::makeError(
+          "Unable to create SegmentedLog for persistent storage");
+    }
+    persistent_block_storage = std::make_unique<SegmentedLogBlockStorage>(
+        std::move(segmented_log.get()),
+        block_transport_factory,
+        log_manager_->getChild("SegmentedLogBlockStorage")->getLogger());
+  } else if (block_store_dir_) {
     auto flat_file = FlatFile::create(
         *block_store_dir_, log_manager_->getChild("FlatFile")->getLogger());
     if (not flat_file) {
@@ -286,8 +340,24 @@ Irohad::RunResult Irohad::initStorage(
     if (boost::get<expected::Error<std::string>>(&create_table_result)) {
       return create_table_result;
     }
-    persistent_block_storage = std::make_unique<PostgresBlockStorage>(
-        pool_wrapper_, block_transport_factory, persistent_table, log_);
+    auto data_format =
+        PostgresBlockStorageFactory::getBlockDataFormat(*sql, persistent_table);
+    if (auto error = resultToOptionalError(data_format)) {
+      return expected::makeError(std::move(*error));
+    }
+    auto format = resultToOptionalValue(data_format).value();
+    if (format == PostgresBlockStorage::BlockDataFormat::kHexText) {
+      log_->warn(
+          "Blocks are stored as hex text, which is slower and takes twice "
+          "as much space. Run iroha_migrate_block_storage to convert them "
+          "to binary form");
+    }
+    persistent_block_storage =
+        std::make_unique<PostgresBlockStorage>(pool_wrapper_,
+                                               block_transport_factory,
+                                               persistent_table,
+                                               format,
+                                               log_);
   }
   return StorageImpl::create(std::move(pg_opt),
                              pool_wrapper_,
@@ -296,7 +366,8 @@ Irohad::RunResult Irohad::initStorage(
                              query_response_factory_,
                              std::move(temporary_block_storage_factory),
                              std::move(persistent_block_storage),
-                             log_manager_->getChild("Storage"))
+                             log_manager_->getChild("Storage"),
+                             pg_pool_size_)
              | [&](auto &&v) -> RunResult {
     storage = std::move(v);
     log_->info("[Init] => storage");
@@ -405,6 +476,9 @@ Irohad::RunResult Irohad::initFactories() {
           shared_model::proto::Transaction>>(
           std::move(transaction_validator),
           std::move(proto_transaction_validator));
+  transaction_builder_ =
+      std::make_shared<shared_model::interface::ParallelTransportBuilder>(
+          std::max(std::thread::hardware_concurrency(), 1u));
 
   // query factories
   std::unique_ptr<shared_model::validation::AbstractValidator<
@@ -442,12 +516,86 @@ Irohad::RunResult Irohad::initFactories() {
  * Initializing persistent cache
  */
 Irohad::RunResult Irohad::initPersistentCache() {
-  persistent_cache = std::make_shared<TxPresenceCacheImpl>(storage);
+  // subscribed before other components, so the filter has the hashes of a
+  // block by the time they process its commit
+  tx_presence_filter_ = loadTxPresenceFilter();
+  if (tx_presence_filter_) {
+    storage->on_commit().subscribe(
+        tx_presence_filter_subscription_,
+        [filter = tx_presence_filter_](const auto &block) {
+          filter->insert(*block);
+        });
+  }
+
+  persistent_cache = std::make_shared<TxPresenceCacheImpl>(
+      storage, tx_presence_cache_size_, tx_presence_filter_);
 
   log_->info("[Init] => persistent cache");
   return {};
 }
 
+std::shared_ptr<TxPresenceFilter> Irohad::loadTxPresenceFilter() {
+  std::shared_ptr<TxPresenceFilter> filter;
+  if (tx_presence_filter_path_) {
+    TxPresenceFilter::load(*tx_presence_filter_path_)
+        .match([&filter](auto &&v) { filter = std::move(v.value); },
+               [this](const auto &e) {
+                 log_->info("Transaction presence filter is not loaded: {}",
+                            e.error);
+               });
+  }
+  if (filter and filter->size() > filter->capacity()) {
+    log_->info("Stored transaction presence filter is full, rebuilding");
+    filter.reset();
+  }
+  if (filter) {
+    auto block_query = storage->getBlockQuery();
+    if (not block_query) {
+      filter.reset();
+    } else {
+      filter->catchUp(*block_query)
+          .match([](const auto &) {},
+                 [this, &filter](const auto &e) {
+                   log_->info(
+                       "Stored transaction presence filter is outdated: {}",
+                       e.error);
+                   filter.reset();
+                 });
+    }
+  }
+
+  if (not filter) {
+    soci::session sql(*pool_wrapper_->connection_pool_);
+    TxPresenceFilter::build(sql).match(
+        [&filter](auto &&v) { filter = std::move(v.value); },
+        [this](const auto &e) {
+          log_->warn("Failed to build transaction presence filter: {}",
+                     e.error);
+        });
+    if (filter) {
+      storeTxPresenceFilter(*filter);
+    }
+  }
+
+  if (filter) {
+    log_->info("[Init] => transaction presence filter of {} hashes",
+               filter->size());
+  }
+  return filter;
+}
+
+void Irohad::storeTxPresenceFilter(const TxPresenceFilter &filter) {
+  if (not tx_presence_filter_path_) {
+    return;
+  }
+  filter.save(*tx_presence_filter_path_)
+      .match([](const auto &) {},
+             [this](const auto &e) {
+               log_->warn("Failed to store transaction presence filter: {}",
+                          e.error);
+             });
+}
+
 /**
  * Initializing ordering gate
  */
@@ -478,9 +626,7 @@ Irohad::RunResult Irohad::initOrderingGate() {
     }
 
     auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
+        boost::get<expected::ValueOf<decltype(block_result)>>(block_result)
             .value;
     hashes.push_back(block->hash());
   }
@@ -524,6 +670,7 @@ Irohad::RunResult Irohad::initOrderingGate() {
                                      proposal_delay_,
                                      std::move(hashes),
                                      transaction_factory,
+                                     transaction_builder_,
                                      batch_parser,
                                      transaction_batch_factory_,
                                      async_call_,
@@ -531,6 +678,8 @@ Irohad::RunResult Irohad::initOrderingGate() {
                                      proposal_factory,
                                      persistent_cache,
                                      proposal_strategy,
+                                     ordering::createPackingPolicy(
+                                         proposal_packing_policy_),
                                      delay,
                                      log_manager_->getChild("Ordering"));
   log_->info("[Init] => init ordering gate - [{}]",
@@ -710,6 +859,7 @@ Irohad::RunResult Irohad::initMstProcessor() {
     mst_transport = std::make_shared<iroha::network::MstTransportGrpc>(
         async_call_,
         transaction_factory,
+        transaction_builder_,
         batch_parser,
         transaction_batch_factory_,
         persistent_cache,
@@ -754,7 +904,8 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
   auto command_service_log_manager = log_manager_->getChild("CommandService");
   auto status_factory =
       std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
-  auto cs_cache = std::make_shared<::torii::CommandServiceImpl::CacheType>();
+  auto cs_cache = std::make_shared<::torii::CommandServiceImpl::CacheType>(
+      tx_status_cache_size_);
   auto tx_processor = std::make_shared<TransactionProcessorImpl>(
       pcs,
       mst_processor,
@@ -770,19 +921,27 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       cs_cache,
       persistent_cache,
       command_service_log_manager->getLogger());
-  command_service_transport =
-      std::make_shared<::torii::CommandServiceTransportGrpc>(
-          command_service,
-          status_bus_,
-          status_factory,
-          transaction_factory,
-          batch_parser,
-          transaction_batch_factory_,
-          consensus_gate_objects.get_observable().map([](const auto &) {
-            return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
-          }),
-          stale_stream_max_rounds_,
-          command_service_log_manager->getChild("Transport")->getLogger());
+  auto make_transport = [&] {
+    return std::make_shared<::torii::CommandServiceTransportGrpc>(
+        command_service,
+        status_bus_,
+        status_factory,
+        transaction_factory,
+        transaction_builder_,
+        batch_parser,
+        transaction_batch_factory_,
+        consensus_gate_objects.get_observable().map([](const auto &) {
+          return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
+        }),
+        stale_stream_max_rounds_,
+        command_service_log_manager->getChild("Transport")->getLogger());
+  };
+  command_service_transport = make_transport();
+  // status streams are served asynchronously, which binds a transport to a
+  // single server
+  if (torii_tls_params_) {
+    command_service_transport_tls = make_transport();
+  }
 
   log_->info("[Init] => command service");
   return {};
@@ -811,7 +970,19 @@ Irohad::RunResult Irohad::initQueryService() {
 }
 
 Irohad::RunResult Irohad::initWsvRestorer() {
-  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
+  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>(
+      log_manager_->getChild("WsvRestorer")->getLogger(), wsv_checkpoints_);
+
+  if (wsv_checkpoints_) {
+    storage->on_commit().subscribe(
+        wsv_checkpoints_subscription_,
+        [checkpoints = wsv_checkpoints_,
+         interval = wsv_checkpoint_options_->interval](const auto &block) {
+          if (interval != 0 and block->height() % interval == 0) {
+            checkpoints->createInBackground();
+          }
+        });
+  }
   return {};
 }
 
@@ -842,9 +1013,12 @@ Irohad::RunResult Irohad::run() {
   };
 
   // Run torii server
-  auto run_result = torii_server->append(command_service_transport)
-                        .append(query_service)
-                        .run()
+  auto run_result =
+      torii_server
+          ->append(command_service_transport,
+                   command_service_transport->serveStatusStreamsAsync())
+          .append(query_service)
+          .run()
       | make_port_logger("Torii");
 
   // Run torii TLS server
@@ -863,7 +1037,9 @@ Irohad::RunResult Irohad::run() {
           false,
           tls_keypair);
       return (*torii_tls_server)
-                 ->append(command_service_transport)
+                 ->append(command_service_transport_tls,
+                          command_service_transport_tls
+                              ->serveStatusStreamsAsync())
                  .append(query_service)
                  .run()
           | make_port_logger("Torii TLS");
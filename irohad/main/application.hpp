@@ -6,6 +6,10 @@
 #ifndef IROHA_APPLICATION_HPP
 #define IROHA_APPLICATION_HPP
 
+#include "ametsuchi/block_store_format.hpp"
+#include "ametsuchi/impl/pool_wrapper.hpp"
+#include "ametsuchi/impl/tx_presence_filter.hpp"
+#include "ametsuchi/impl/wsv_checkpoints.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
@@ -30,7 +34,6 @@ namespace iroha {
     class Storage;
     class ReconnectionStrategyFactory;
     class PostgresOptions;
-    struct PoolWrapper;
   }  // namespace ametsuchi
   namespace consensus {
     namespace yac {
@@ -70,6 +73,7 @@ namespace shared_model {
     class Keypair;
   }
   namespace interface {
+    class ParallelTransportBuilder;
     class QueryResponseFactory;
     class TransactionBatchFactory;
   }  // namespace interface
@@ -98,6 +102,25 @@ class Irohad {
    * transactions
    * @param stale_stream_max_rounds - maximum number of rounds between
    * consecutive status emissions
+   * @param proposal_packing_policy - policy of selecting pending batches for
+   * proposals in ordering service
+   * @param block_store_format - layout of blocks in block_store_dir
+   * @param block_store_sync_interval - number of blocks appended to block store
+   * between flushes to disk, 0 leaves flushing to the OS. Applies to segmented
+   * log format
+   * @param pg_pool_size - number of connections used by block commit,
+   * consensus and other internal components
+   * @param pg_query_pool - separate connection pool for client queries. If
+   * not set, queries share the main pool
+   * @param wsv_checkpoints - periodic WSV checkpoints used to speed up WSV
+   * restoration. If not set, WSV is restored from the whole ledger
+   * @param tx_status_cache_size - number of transaction statuses kept in
+   * memory by torii
+   * @param tx_presence_cache_size - number of committed and rejected
+   * transaction hashes kept in memory by the transaction presence cache
+   * @param tx_presence_filter_path - file where the filter of committed and
+   * rejected transaction hashes is stored on shutdown and loaded on start.
+   * If not set, the filter is built from the ledger on every start
    * @param opt_alternative_peers - optional alternative initial peers list
    * @param logger_manager - the logger manager to use
    * @param opt_mst_gossip_params - parameters for Gossip MST propagation
@@ -118,6 +141,16 @@ class Irohad {
          const shared_model::crypto::Keypair &keypair,
          std::chrono::milliseconds max_rounds_delay,
          size_t stale_stream_max_rounds,
+         iroha::ordering::PackingPolicyType proposal_packing_policy,
+         iroha::ametsuchi::BlockStoreFormat block_store_format,
+         size_t block_store_sync_interval,
+         size_t pg_pool_size,
+         boost::optional<iroha::ametsuchi::QueryPoolOptions> pg_query_pool,
+         boost::optional<iroha::ametsuchi::WsvCheckpointOptions>
+             wsv_checkpoints,
+         size_t tx_status_cache_size,
+         size_t tx_presence_cache_size,
+         boost::optional<std::string> tx_presence_filter_path,
          boost::optional<shared_model::interface::types::PeerList>
              opt_alternative_peers,
          logger::LoggerManagerTreePtr logger_manager,
@@ -167,6 +200,17 @@ class Irohad {
 
   virtual RunResult initPersistentCache();
 
+  /**
+   * Load the transaction presence filter from tx_presence_filter_path_ and
+   * add the blocks committed since it was stored, or build it from the
+   * ledger if it cannot be loaded
+   * @return the filter, or nullptr if it cannot be built
+   */
+  std::shared_ptr<iroha::ametsuchi::TxPresenceFilter> loadTxPresenceFilter();
+
+  /// Store the filter to tx_presence_filter_path_ if it is set
+  void storeTxPresenceFilter(const iroha::ametsuchi::TxPresenceFilter &filter);
+
   virtual RunResult initOrderingGate();
 
   virtual RunResult initSimulator();
@@ -213,6 +257,16 @@ class Irohad {
   std::chrono::minutes mst_expiration_time_;
   std::chrono::milliseconds max_rounds_delay_;
   size_t stale_stream_max_rounds_;
+  iroha::ordering::PackingPolicyType proposal_packing_policy_;
+  iroha::ametsuchi::BlockStoreFormat block_store_format_;
+  size_t block_store_sync_interval_;
+  size_t pg_pool_size_;
+  boost::optional<iroha::ametsuchi::QueryPoolOptions> pg_query_pool_;
+  boost::optional<iroha::ametsuchi::WsvCheckpointOptions>
+      wsv_checkpoint_options_;
+  size_t tx_status_cache_size_;
+  size_t tx_presence_cache_size_;
+  boost::optional<std::string> tx_presence_filter_path_;
   const boost::optional<shared_model::interface::types::PeerList>
       opt_alternative_peers_;
   boost::optional<iroha::GossipPropagationStrategyParams>
@@ -246,6 +300,8 @@ class Irohad {
 
   // WSV restorer
   std::shared_ptr<iroha::ametsuchi::WsvRestorer> wsv_restorer_;
+  std::shared_ptr<iroha::ametsuchi::WsvCheckpoints> wsv_checkpoints_;
+  rxcpp::composite_subscription wsv_checkpoints_subscription_;
 
   // crypto provider
   std::shared_ptr<shared_model::crypto::AbstractCryptoModelSigner<
@@ -279,6 +335,10 @@ class Irohad {
       iroha::protocol::Transaction>>
       transaction_factory;
 
+  // pool to build transaction lists received from clients and peers on
+  std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+      transaction_builder_;
+
   // query factory
   std::shared_ptr<shared_model::interface::AbstractTransportFactory<
       shared_model::interface::Query,
@@ -292,6 +352,8 @@ class Irohad {
       blocks_query_factory;
 
   // persistent cache
+  std::shared_ptr<iroha::ametsuchi::TxPresenceFilter> tx_presence_filter_;
+  rxcpp::composite_subscription tx_presence_filter_subscription_;
   std::shared_ptr<iroha::ametsuchi::TxPresenceCache> persistent_cache;
 
   // proposal factory
@@ -330,6 +392,8 @@ class Irohad {
   std::shared_ptr<iroha::torii::CommandService> command_service;
   std::shared_ptr<iroha::torii::CommandServiceTransportGrpc>
       command_service_transport;
+  std::shared_ptr<iroha::torii::CommandServiceTransportGrpc>
+      command_service_transport_tls;
 
   // query service
   std::shared_ptr<iroha::torii::QueryService> query_service;
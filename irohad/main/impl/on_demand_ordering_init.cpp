@@ -60,13 +60,20 @@ namespace iroha {
             async_call,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
+        std::shared_ptr<ordering::transport::OdOsTransactionsSource>
+            transactions_source,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::transport::OnDemandOsClientGrpcFactory>(
           std::move(async_call),
           std::move(proposal_transport_factory),
           [] { return std::chrono::system_clock::now(); },
           delay,
-          ordering_log_manager->getChild("NetworkClient")->getLogger());
+          ordering_log_manager->getChild("NetworkClient")->getLogger(),
+          std::move(transactions_source),
+          std::make_shared<
+              ordering::transport::OnDemandOsClientGrpc::ProposalAsyncCallType>(
+              ordering_log_manager->getChild("AsyncPrefetchClient")
+                  ->getLogger()));
     }
 
     auto OnDemandOrderingInit::createConnectionManager(
@@ -75,6 +82,8 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
+        std::shared_ptr<ordering::transport::OdOsTransactionsSource>
+            transactions_source,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       // since top block will be the first in commit_notifier observable,
       // hashes of two previous blocks are prepended
@@ -167,6 +176,7 @@ namespace iroha {
          * v, round 1,0 - kRejectCommitConsumer
          * v, round 2,0 - kCommitCommitConsumer
          * o, round 0,0 - kIssuer
+         * x, round 0,1 - kNextRejectIssuer
          */
         peers.peers.at(OnDemandConnectionManager::kRejectRejectConsumer) =
             getOsPeer(kCurrentRound,
@@ -180,6 +190,8 @@ namespace iroha {
             getOsPeer(kRoundAfterNext, ordering::kNextCommitRoundConsumer);
         peers.peers.at(OnDemandConnectionManager::kIssuer) =
             getOsPeer(kCurrentRound, current_round.reject_round);
+        peers.peers.at(OnDemandConnectionManager::kNextRejectIssuer) =
+            getOsPeer(kCurrentRound, current_round.reject_round + 1);
         return peers;
       };
 
@@ -191,6 +203,7 @@ namespace iroha {
           createNotificationFactory(std::move(async_call),
                                     std::move(proposal_transport_factory),
                                     delay,
+                                    std::move(transactions_source),
                                     ordering_log_manager),
           peers,
           ordering_log_manager->getChild("ConnectionManager")->getLogger());
@@ -304,12 +317,14 @@ namespace iroha {
             proposal_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+        std::shared_ptr<ordering::BatchesPackingPolicy> packing_policy,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
           max_number_of_transactions,
           std::move(proposal_factory),
           std::move(tx_cache),
           creation_strategy,
+          std::move(packing_policy),
           ordering_log_manager->getChild("Service")->getLogger());
     }
 
@@ -326,6 +341,8 @@ namespace iroha {
         std::shared_ptr<
             ordering::transport::OnDemandOsServerGrpc::TransportFactoryType>
             transaction_factory,
+        std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+            transaction_builder,
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser,
         std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -337,6 +354,7 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+        std::shared_ptr<ordering::BatchesPackingPolicy> packing_policy,
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func,
         logger::LoggerManagerTreePtr ordering_log_manager) {
@@ -344,10 +362,12 @@ namespace iroha {
                                             proposal_factory,
                                             tx_cache,
                                             creation_strategy,
+                                            std::move(packing_policy),
                                             ordering_log_manager);
       service = std::make_shared<ordering::transport::OnDemandOsServerGrpc>(
           ordering_service,
           std::move(transaction_factory),
+          std::move(transaction_builder),
           std::move(batch_parser),
           std::move(transaction_batch_factory),
           ordering_log_manager->getChild("Server")->getLogger());
@@ -357,6 +377,7 @@ namespace iroha {
                                   std::move(proposal_transport_factory),
                                   delay,
                                   std::move(initial_hashes),
+                                  ordering_service,
                                   ordering_log_manager),
           std::make_shared<ordering::cache::OnDemandCache>(),
           std::move(proposal_factory),
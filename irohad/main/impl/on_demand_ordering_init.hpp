@@ -18,6 +18,7 @@
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/batches_packing_policy.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
@@ -46,6 +47,8 @@ namespace iroha {
               async_call,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
+          std::shared_ptr<ordering::transport::OdOsTransactionsSource>
+              transactions_source,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -59,6 +62,8 @@ namespace iroha {
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
+          std::shared_ptr<ordering::transport::OdOsTransactionsSource>
+              transactions_source,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -88,6 +93,7 @@ namespace iroha {
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ordering::BatchesPackingPolicy> packing_policy,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       rxcpp::composite_subscription sync_event_notifier_lifetime_;
@@ -110,6 +116,8 @@ namespace iroha {
        * rounds they are required since hash of block i defines round i + k
        * @param transaction_factory transport factory for transactions required
        * by ordering service network endpoint
+       * @param transaction_builder pool to build transactions received by
+       * ordering service network endpoint on
        * @param batch_parser transaction batch parser required by ordering
        * service network endpoint
        * @param transaction_batch_factory transport factory for transaction
@@ -120,6 +128,8 @@ namespace iroha {
        * proposals
        * @param creation_strategy - provides a strategy for creating proposals
        * in OS
+       * @param packing_policy - policy of selecting pending batches for
+       * proposals in OS
        * @return initialized ordering gate
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
@@ -129,6 +139,8 @@ namespace iroha {
           std::shared_ptr<
               ordering::transport::OnDemandOsServerGrpc::TransportFactoryType>
               transaction_factory,
+          std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+              transaction_builder,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
           std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -140,6 +152,7 @@ namespace iroha {
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ordering::ProposalCreationStrategy> creation_strategy,
+          std::shared_ptr<ordering::BatchesPackingPolicy> packing_policy,
           std::function<std::chrono::milliseconds(
               const synchronizer::SynchronizationEvent &)> delay_func,
           logger::LoggerManagerTreePtr ordering_log_manager);
@@ -5,6 +5,7 @@
 
 #include "main/impl/pg_connection_init.hpp"
 
+#include "ametsuchi/impl/connection_pool_monitor.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
@@ -45,7 +46,8 @@ PgConnectionInit::prepareConnectionPool(
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const PostgresOptions &options,
     const int pool_size,
-    logger::LoggerManagerTreePtr log_manager) {
+    logger::LoggerManagerTreePtr log_manager,
+    const boost::optional<QueryPoolOptions> &query_pool_options) {
   auto options_str = options.workingConnectionString();
 
   auto conn = initPostgresConnection(options_str, pool_size);
@@ -82,10 +84,92 @@ PgConnectionInit::prepareConnectionPool(
                              options.maintenanceConnectionString(),
                              log_manager);
 
+    if (not query_pool_options) {
+      return expected::makeValue<std::shared_ptr<PoolWrapper>>(
+          std::make_shared<PoolWrapper>(std::move(connection),
+                                        std::move(failover_callback_factory),
+                                        enable_prepared_transactions));
+    }
+
+    auto make_query_pool = [&](std::string options_str,
+                               const std::string &maintenance_options_str,
+                               const std::string &log_name,
+                               bool prepare_tables)
+        -> expected::Result<std::shared_ptr<soci::connection_pool>,
+                            std::string> {
+      auto query_conn =
+          initPostgresConnection(options_str, query_pool_options->size);
+      if (auto e = boost::get<expected::Error<std::string>>(&query_conn)) {
+        return *e;
+      }
+      auto &query_connection =
+          boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(
+              query_conn)
+              .value;
+      initializeConnectionPool(*query_connection,
+                               query_pool_options->size,
+                               [](soci::session &) {},
+                               *failover_callback_factory,
+                               reconnection_strategy_factory,
+                               maintenance_options_str,
+                               log_manager->getChild(log_name),
+                               prepare_tables);
+      return expected::makeValue(std::move(query_connection));
+    };
+    auto make_monitor = [&](const std::string &log_name) {
+      return std::make_shared<ConnectionPoolMonitor>(
+          query_pool_options->size,
+          query_pool_options->lease_timeout,
+          log_manager->getChild(log_name)->getLogger());
+    };
+
+    // queries are served by the replica, if there is one
+    auto replica_options_str = options.replicaConnectionString();
+    auto query_pool = make_query_pool(
+        replica_options_str.value_or(options_str),
+        options.replicaMaintenanceConnectionString().value_or(
+            options.maintenanceConnectionString()),
+        "QueryPool",
+        not replica_options_str);
+    if (auto e = boost::get<expected::Error<std::string>>(&query_pool)) {
+      return *e;
+    }
+    auto &query_connection =
+        boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(
+            query_pool)
+            .value;
+
+    // while the replica lags behind, queries are served by the working
+    // database through a pool of their own, so that they still do not
+    // compete with block commit for connections
+    std::shared_ptr<soci::connection_pool> primary_query_connection;
+    std::shared_ptr<ConnectionPoolMonitor> primary_query_monitor;
+    if (replica_options_str) {
+      auto primary_query_pool =
+          make_query_pool(options_str,
+                          options.maintenanceConnectionString(),
+                          "PrimaryQueryPool",
+                          false);
+      if (auto e =
+              boost::get<expected::Error<std::string>>(&primary_query_pool)) {
+        return *e;
+      }
+      primary_query_connection = std::move(
+          boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(
+              primary_query_pool)
+              .value);
+      primary_query_monitor = make_monitor("PrimaryQueryPool");
+    }
+
     return expected::makeValue<std::shared_ptr<PoolWrapper>>(
         std::make_shared<PoolWrapper>(std::move(connection),
                                       std::move(failover_callback_factory),
-                                      enable_prepared_transactions));
+                                      enable_prepared_transactions,
+                                      std::move(query_connection),
+                                      query_pool_options->size,
+                                      make_monitor("QueryPool"),
+                                      std::move(primary_query_connection),
+                                      std::move(primary_query_monitor)));
 
   } catch (const std::exception &e) {
     return expected::makeError(e.what());
@@ -162,7 +246,8 @@ void PgConnectionInit::initializeConnectionPool(
     FailoverCallbackHolder &callback_factory,
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const std::string &pg_reconnection_options,
-    logger::LoggerManagerTreePtr log_manager) {
+    logger::LoggerManagerTreePtr log_manager,
+    bool prepare_tables) {
   auto log = log_manager->getLogger();
   auto initialize_session = [&](soci::session &session,
                                 auto on_init_db,
@@ -182,7 +267,9 @@ void PgConnectionInit::initializeConnectionPool(
     // rollback current prepared transaction
     // if there exists any since last session
     try_rollback(session);
-    prepareTables(session);
+    if (prepare_tables) {
+      prepareTables(session);
+    }
   };
 
   /// lambda contains actions which should be invoked once for each
@@ -233,9 +320,36 @@ CREATE TABLE IF NOT EXISTS account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE IF NOT EXISTS account_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value jsonb NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+CREATE INDEX IF NOT EXISTS account_detail_key_index
+    ON account_detail
+    USING btree
+    (account_id, key);
+DO $$
+BEGIN
+    -- details were kept in a JSONB column of account by previous versions
+    IF EXISTS (SELECT * FROM information_schema.columns
+               WHERE table_schema = current_schema()
+               AND table_name = 'account'
+               AND column_name = 'data') THEN
+        INSERT INTO account_detail (account_id, writer, key, value)
+            SELECT account.account_id, by_writer.key, plain.key, plain.value
+            FROM account,
+                jsonb_each(account.data) by_writer,
+                jsonb_each(by_writer.value) plain
+            ON CONFLICT DO NOTHING;
+        ALTER TABLE account DROP COLUMN data;
+    END IF;
+END
+$$;
 CREATE TABLE IF NOT EXISTS account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
     public_key varchar NOT NULL REFERENCES signatory,
@@ -306,6 +420,11 @@ CREATE INDEX IF NOT EXISTS position_by_account_asset_index
     ON position_by_account_asset
     USING btree
     (account_id, asset_id, height, index ASC);
+CREATE TABLE IF NOT EXISTS top_block_info (
+    lock char(1) DEFAULT 'X' NOT NULL PRIMARY KEY CHECK (lock = 'X'),
+    height bigint NOT NULL,
+    hash character varying(128) NOT NULL
+);
 CREATE TABLE IF NOT EXISTS setting(
     setting_key text,
     setting_value text,
@@ -320,6 +439,7 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
   try {
     static const std::string reset = R"(
       TRUNCATE TABLE account_has_signatory RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_detail RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
@@ -335,6 +455,7 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE tx_position_by_creator RESTART IDENTITY CASCADE;
       TRUNCATE TABLE position_by_account_asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE setting RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE top_block_info RESTART IDENTITY CASCADE;
     )";
     sql << reset;
   } catch (std::exception &e) {
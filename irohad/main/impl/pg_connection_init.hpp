@@ -14,6 +14,7 @@
 #include <boost/range/algorithm/replace_if.hpp>
 
 #include "ametsuchi/impl/failover_callback_holder.hpp"
+#include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
@@ -25,20 +26,34 @@
 namespace iroha {
   namespace ametsuchi {
 
-    struct PoolWrapper;
-
     class PgConnectionInit {
      public:
       static expected::Result<std::shared_ptr<soci::connection_pool>,
                               std::string>
       initPostgresConnection(std::string &options_str, size_t pool_size);
 
+      /**
+       * Open connection pools to the working database and create its tables
+       * @param reconnection_strategy_factory - factory of reconnection
+       * strategies for each connection
+       * @param options - database options
+       * @param pool_size - number of connections in the main pool
+       * @param log_manager - log manager of storage
+       * @param query_pool_options - options of a separate pool for client
+       * queries. If not set, queries use the main pool. The pool connects to
+       * the replica of options, if it is set. In that case a second pool of
+       * the same size connects to the working database and serves queries
+       * while the replica lags behind
+       * @return pools or error message
+       */
       static expected::Result<std::shared_ptr<PoolWrapper>, std::string>
       prepareConnectionPool(
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const PostgresOptions &options,
           const int pool_size,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          const boost::optional<QueryPoolOptions> &query_pool_options =
+              boost::none);
 
       /**
        * Verify whether postgres supports prepared transactions
@@ -101,6 +116,8 @@ namespace iroha {
        * @param pg_reconnection_options - parameter of connection startup on
        * reconnect
        * @param log_manager - log manager of storage
+       * @param prepare_tables - whether to create the tables, which is not
+       * possible on a read-only replica
        * @tparam RollbackFunction - type of rollback function
        */
       template <typename RollbackFunction>
@@ -111,7 +128,8 @@ namespace iroha {
           FailoverCallbackHolder &callback_factory,
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const std::string &pg_reconnection_options,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          bool prepare_tables = true);
     };
   }  // namespace ametsuchi
 }  // namespace iroha
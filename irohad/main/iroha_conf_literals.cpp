@@ -7,6 +7,12 @@
 
 namespace config_members {
   const char *BlockStorePath = "block_store_path";
+  const char *BlockStoreFormat = "block_store_format";
+  const std::unordered_map<std::string, iroha::ametsuchi::BlockStoreFormat>
+      BlockStoreFormats{
+          {"flat_file", iroha::ametsuchi::BlockStoreFormat::kFlatFile},
+          {"segmented_log", iroha::ametsuchi::BlockStoreFormat::kSegmentedLog}};
+  const char *BlockStoreSyncInterval = "block_store_sync_interval";
   const char *ToriiPort = "torii_port";
   const char *ToriiTlsParams = "torii_tls_params";
   const char *InternalPort = "internal_port";
@@ -19,6 +25,12 @@ namespace config_members {
   const char *Password = "password";
   const char *WorkingDbName = "working database";
   const char *MaintenanceDbName = "maintenance database";
+  const char *Replica = "replica";
+  const char *PgPoolSize = "pg_pool_size";
+  const char *PgQueryPoolSize = "pg_query_pool_size";
+  const char *PgQueryLeaseTimeout = "pg_query_lease_timeout";
+  const char *WsvCheckpointPath = "wsv_checkpoint_path";
+  const char *WsvCheckpointInterval = "wsv_checkpoint_interval";
   const char *MaxProposalSize = "max_proposal_size";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
@@ -26,6 +38,15 @@ namespace config_members {
   const char *MstExpirationTime = "mst_expiration_time";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
+  const char *TxStatusCacheSize = "tx_status_cache_size";
+  const char *TxPresenceCacheSize = "tx_presence_cache_size";
+  const char *TxPresenceFilterPath = "tx_presence_filter_path";
+  const char *ProposalPackingPolicy = "proposal_packing_policy";
+  const std::unordered_map<std::string, iroha::ordering::PackingPolicyType>
+      PackingPolicies{
+          {"fifo", iroha::ordering::PackingPolicyType::kFifo},
+          {"round_robin", iroha::ordering::PackingPolicyType::kRoundRobin},
+          {"knapsack", iroha::ordering::PackingPolicyType::kKnapsack}};
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
@@ -9,10 +9,17 @@
 #include <string>
 #include <unordered_map>
 
+#include "ametsuchi/block_store_format.hpp"
 #include "logger/logger.hpp"
+#include "ordering/packing_policy_type.hpp"
 
 namespace config_members {
   extern const char *BlockStorePath;
+  extern const char *BlockStoreFormat;
+  extern const std::unordered_map<std::string,
+                                  iroha::ametsuchi::BlockStoreFormat>
+      BlockStoreFormats;
+  extern const char *BlockStoreSyncInterval;
   extern const char *ToriiPort;
   extern const char *ToriiTlsParams;
   extern const char *InternalPort;
@@ -25,6 +32,12 @@ namespace config_members {
   extern const char *Password;
   extern const char *WorkingDbName;
   extern const char *MaintenanceDbName;
+  extern const char *Replica;
+  extern const char *PgPoolSize;
+  extern const char *PgQueryPoolSize;
+  extern const char *PgQueryLeaseTimeout;
+  extern const char *WsvCheckpointPath;
+  extern const char *WsvCheckpointInterval;
   extern const char *MaxProposalSize;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
@@ -32,6 +45,13 @@ namespace config_members {
   extern const char *MstExpirationTime;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
+  extern const char *TxStatusCacheSize;
+  extern const char *TxPresenceCacheSize;
+  extern const char *TxPresenceFilterPath;
+  extern const char *ProposalPackingPolicy;
+  extern const std::unordered_map<std::string,
+                                  iroha::ordering::PackingPolicyType>
+      PackingPolicies;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
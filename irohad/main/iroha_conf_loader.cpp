@@ -8,6 +8,7 @@
 #include <fstream>
 #include <limits>
 #include <sstream>
+#include <unordered_map>
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
@@ -293,6 +294,44 @@ inline void JsonDeserializerImpl::getVal<logger::LogLevel>(
   dest = it->second;
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::ordering::PackingPolicyType>(
+    const std::string &path,
+    iroha::ordering::PackingPolicyType &dest,
+    const rapidjson::Value &src) {
+  std::string policy_str;
+  getVal(path, policy_str, src);
+  const auto it = config_members::PackingPolicies.find(policy_str);
+  if (it == config_members::PackingPolicies.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong proposal packing policy at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::PackingPolicies | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::ametsuchi::BlockStoreFormat>(
+    const std::string &path,
+    iroha::ametsuchi::BlockStoreFormat &dest,
+    const rapidjson::Value &src) {
+  std::string format_str;
+  getVal(path, format_str, src);
+  const auto it = config_members::BlockStoreFormats.find(format_str);
+  if (it == config_members::BlockStoreFormats.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong block store format at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::BlockStoreFormats | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<logger::LogPatterns>(
     const std::string &path,
@@ -359,6 +398,18 @@ inline void JsonDeserializerImpl::getVal<iroha::torii::TlsParams>(
   getValByKey(path, dest.key_path, obj, config_members::KeyPairPath);
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig::ReplicaConfig>(
+    const std::string &path,
+    IrohadConfig::DbConfig::ReplicaConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(),
+               path + " database replica config must be an object.");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.host, obj, config_members::Host);
+  getValByKey(path, dest.port, obj, config_members::Port);
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
     const std::string &path,
@@ -374,6 +425,7 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
   getValByKey(path, dest.working_dbname, obj, config_members::WorkingDbName);
   getValByKey(
       path, dest.maintenance_dbname, obj, config_members::MaintenanceDbName);
+  getValByKey(path, dest.replica, obj, config_members::Replica);
 }
 
 template <>
@@ -401,6 +453,43 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
               dest.stale_stream_max_rounds,
               obj,
               config_members::StaleStreamMaxRounds);
+  getValByKey(path,
+              dest.tx_status_cache_size,
+              obj,
+              config_members::TxStatusCacheSize);
+  getValByKey(path,
+              dest.tx_presence_cache_size,
+              obj,
+              config_members::TxPresenceCacheSize);
+  getValByKey(path,
+              dest.tx_presence_filter_path,
+              obj,
+              config_members::TxPresenceFilterPath);
+  getValByKey(path,
+              dest.proposal_packing_policy,
+              obj,
+              config_members::ProposalPackingPolicy);
+  getValByKey(path,
+              dest.block_store_format,
+              obj,
+              config_members::BlockStoreFormat);
+  getValByKey(path,
+              dest.block_store_sync_interval,
+              obj,
+              config_members::BlockStoreSyncInterval);
+  getValByKey(path, dest.pg_pool_size, obj, config_members::PgPoolSize);
+  getValByKey(
+      path, dest.pg_query_pool_size, obj, config_members::PgQueryPoolSize);
+  getValByKey(path,
+              dest.pg_query_lease_timeout,
+              obj,
+              config_members::PgQueryLeaseTimeout);
+  getValByKey(
+      path, dest.wsv_checkpoint_path, obj, config_members::WsvCheckpointPath);
+  getValByKey(path,
+              dest.wsv_checkpoint_interval,
+              obj,
+              config_members::WsvCheckpointInterval);
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
 }
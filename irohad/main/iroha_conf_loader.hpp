@@ -9,19 +9,28 @@
 #include <string>
 #include <unordered_map>
 
+#include "ametsuchi/block_store_format.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_manager.hpp"
+#include "ordering/batches_packing_policy.hpp"
 #include "torii/tls_params.hpp"
 
 struct IrohadConfig {
   struct DbConfig {
+    /// read-only standby which serves client queries
+    struct ReplicaConfig {
+      std::string host;
+      uint16_t port;
+    };
+
     std::string host;
     uint16_t port;
     std::string user;
     std::string password;
     std::string working_dbname;
     std::string maintenance_dbname;
+    boost::optional<ReplicaConfig> replica;
   };
 
   // TODO: block_store_path is now optional, change docs IR-576
@@ -41,6 +50,17 @@ struct IrohadConfig {
   boost::optional<uint32_t> mst_expiration_time;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
+  boost::optional<uint32_t> tx_status_cache_size;
+  boost::optional<uint32_t> tx_presence_cache_size;
+  boost::optional<std::string> tx_presence_filter_path;
+  boost::optional<iroha::ordering::PackingPolicyType> proposal_packing_policy;
+  boost::optional<iroha::ametsuchi::BlockStoreFormat> block_store_format;
+  boost::optional<uint32_t> block_store_sync_interval;
+  boost::optional<uint32_t> pg_pool_size;
+  boost::optional<uint32_t> pg_query_pool_size;
+  boost::optional<uint32_t> pg_query_lease_timeout;
+  boost::optional<std::string> wsv_checkpoint_path;
+  boost::optional<uint32_t> wsv_checkpoint_interval;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
 };
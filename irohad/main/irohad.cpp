@@ -29,6 +29,16 @@ static const std::string kLogSettingsFromConfigFile = "config_file";
 static const uint32_t kMstExpirationTimeDefault = 1440;
 static const uint32_t kMaxRoundsDelayDefault = 3000;
 static const uint32_t kStaleStreamMaxRoundsDefault = 2;
+static const uint32_t kTxStatusCacheSizeDefault = 20000;
+static const uint32_t kTxPresenceCacheSizeDefault = 20000;
+static const iroha::ordering::PackingPolicyType kProposalPackingPolicyDefault =
+    iroha::ordering::PackingPolicyType::kFifo;
+static const iroha::ametsuchi::BlockStoreFormat kBlockStoreFormatDefault =
+    iroha::ametsuchi::BlockStoreFormat::kFlatFile;
+static const uint32_t kBlockStoreSyncIntervalDefault = 1;
+static const uint32_t kPgPoolSizeDefault = 10;
+static const uint32_t kPgQueryPoolSizeDefault = 5;
+static const uint32_t kPgQueryLeaseTimeoutDefault = 1000;
 static const std::string kDefaultWorkingDatabaseName{"iroha_default"};
 
 /**
@@ -178,6 +188,12 @@ int main(int argc, char *argv[]) {
 
   std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt;
   if (config.database_config) {
+    boost::optional<iroha::ametsuchi::PostgresOptions::Replica> replica;
+    if (config.database_config->replica) {
+      replica = iroha::ametsuchi::PostgresOptions::Replica{
+          config.database_config->replica->host,
+          config.database_config->replica->port};
+    }
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
         config.database_config->host,
         config.database_config->port,
@@ -185,7 +201,8 @@ int main(int argc, char *argv[]) {
         config.database_config->password,
         config.database_config->working_dbname,
         config.database_config->maintenance_dbname,
-        log);
+        log,
+        std::move(replica));
   } else if (config.pg_opt) {
     log->warn("Using deprecated database connection string!");
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
@@ -195,6 +212,30 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  // client queries get a pool of their own unless its size is set to 0
+  boost::optional<iroha::ametsuchi::QueryPoolOptions> query_pool_options;
+  auto query_pool_size =
+      config.pg_query_pool_size.value_or(kPgQueryPoolSizeDefault);
+  if (query_pool_size == 0 and pg_opt->replicaConnectionString()) {
+    log->warn("Database replica is used only by a separate query pool, "
+              "which is disabled with {} = 0",
+              config_members::PgQueryPoolSize);
+  }
+  if (query_pool_size > 0) {
+    query_pool_options = iroha::ametsuchi::QueryPoolOptions{
+        query_pool_size,
+        std::chrono::milliseconds(config.pg_query_lease_timeout.value_or(
+            kPgQueryLeaseTimeoutDefault))};
+  }
+
+  boost::optional<iroha::ametsuchi::WsvCheckpointOptions> wsv_checkpoints;
+  if (config.wsv_checkpoint_path) {
+    wsv_checkpoints = iroha::ametsuchi::WsvCheckpointOptions{
+        *config.wsv_checkpoint_path,
+        config.wsv_checkpoint_interval.value_or(
+            iroha::ametsuchi::WsvCheckpoints::kDefaultInterval)};
+  }
+
   // Configuring iroha daemon
   Irohad irohad(
       config.block_store_path,
@@ -212,6 +253,16 @@ int main(int argc, char *argv[]) {
       std::chrono::milliseconds(
           config.max_round_delay_ms.value_or(kMaxRoundsDelayDefault)),
       config.stale_stream_max_rounds.value_or(kStaleStreamMaxRoundsDefault),
+      config.proposal_packing_policy.value_or(kProposalPackingPolicyDefault),
+      config.block_store_format.value_or(kBlockStoreFormatDefault),
+      config.block_store_sync_interval.value_or(
+          kBlockStoreSyncIntervalDefault),
+      config.pg_pool_size.value_or(kPgPoolSizeDefault),
+      query_pool_options,
+      std::move(wsv_checkpoints),
+      config.tx_status_cache_size.value_or(kTxStatusCacheSizeDefault),
+      config.tx_presence_cache_size.value_or(kTxPresenceCacheSizeDefault),
+      config.tx_presence_filter_path,
       std::move(config.initial_peers),
       log_manager->getChild("Irohad"),
       boost::make_optional(config.mst_support,
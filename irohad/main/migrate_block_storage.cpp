@@ -0,0 +1,100 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gflags/gflags.h>
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_block_storage_factory.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/iroha_conf_loader.hpp"
+#include "validators/field_validator.hpp"
+
+static const std::string kDefaultWorkingDatabaseName{"iroha_default"};
+
+/**
+ * Gflag validator.
+ * Validator for the configuration file path input argument.
+ * Path is considered to be valid if it is not empty.
+ * @param flag_name - flag name. Must be 'config' in this case
+ * @param path      - file name. Should be path to the config file
+ * @return true if argument is valid
+ */
+bool validate_config(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+/**
+ * Creating input argument for the configuration file location.
+ */
+DEFINE_string(config, "", "Specify iroha provisioning path.");
+/**
+ * Registering validator for the configuration file location.
+ */
+DEFINE_validator(config, &validate_config);
+
+/**
+ * Creating input argument for the name of block storage table.
+ */
+DEFINE_string(table, "blocks", "Specify name of block storage table");
+
+/**
+ * Converts blocks stored in Postgres block storage from hex text to binary
+ * form. Irohad must be stopped during the migration.
+ */
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto validators_config =
+      std::make_shared<shared_model::validation::ValidatorsConfig>(0);
+  const auto config = parse_iroha_config(
+      FLAGS_config,
+      std::make_shared<shared_model::proto::ProtoCommonObjectsFactory<
+          shared_model::validation::FieldValidator>>(validators_config));
+  auto log_manager = config.logger_manager.value_or(
+      std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+          logger::LogLevel::kInfo, logger::getDefaultLogPatterns()}));
+  auto log = log_manager->getChild("MigrateBlockStorage")->getLogger();
+
+  std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt;
+  if (config.database_config) {
+    pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
+        config.database_config->host,
+        config.database_config->port,
+        config.database_config->user,
+        config.database_config->password,
+        config.database_config->working_dbname,
+        config.database_config->maintenance_dbname,
+        log);
+  } else if (config.pg_opt) {
+    pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
+        config.pg_opt.value(), kDefaultWorkingDatabaseName, log);
+  } else {
+    log->critical("Missing database configuration!");
+    return EXIT_FAILURE;
+  }
+
+  try {
+    soci::session sql(*soci::factory_postgresql(),
+                      pg_opt->workingConnectionString());
+    return iroha::ametsuchi::PostgresBlockStorageFactory::migrateToBinary(
+               sql, FLAGS_table)
+        .match(
+            [&](const auto &) {
+              log->info("Blocks in table {} are stored in binary form",
+                        FLAGS_table);
+              return EXIT_SUCCESS;
+            },
+            [&](const auto &e) {
+              log->error("Migration failed: {}", e.error);
+              return EXIT_FAILURE;
+            });
+  } catch (const std::exception &e) {
+    log->error("Unable to connect to the database: {}", e.what());
+    return EXIT_FAILURE;
+  }
+}
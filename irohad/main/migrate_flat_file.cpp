@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gflags/gflags.h>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "logger/logger.hpp"
+#include "logger/logger_manager.hpp"
+
+/**
+ * Gflag validator.
+ * Validator for the directory path input arguments.
+ * Path is considered to be valid if it is not empty.
+ * @param flag_name - flag name
+ * @param path      - directory name
+ * @return true if argument is valid
+ */
+bool validate_dir(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+/**
+ * Creating input argument for the flat file block store location.
+ */
+DEFINE_string(flat_file_dir, "", "Specify flat file block store path");
+DEFINE_validator(flat_file_dir, &validate_dir);
+
+/**
+ * Creating input argument for the segmented log block store location.
+ */
+DEFINE_string(segmented_log_dir, "", "Specify segmented log block store path");
+DEFINE_validator(segmented_log_dir, &validate_dir);
+
+/**
+ * Copies blocks from flat file block store to a new segmented log one,
+ * converting them from JSON to binary protobuf.
+ * Irohad must be stopped during the migration.
+ */
+int main(int argc, char *argv[]) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  auto log_manager =
+      std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+          logger::LogLevel::kInfo, logger::getDefaultLogPatterns()});
+  auto log = log_manager->getChild("MigrateFlatFile")->getLogger();
+
+  auto flat_file = iroha::ametsuchi::FlatFile::create(
+      FLAGS_flat_file_dir, log_manager->getChild("FlatFile")->getLogger());
+  if (not flat_file) {
+    log->error("Unable to open flat file block store");
+    return EXIT_FAILURE;
+  }
+  // records are flushed once when the log is closed
+  auto segmented_log = iroha::ametsuchi::SegmentedLog::create(
+      FLAGS_segmented_log_dir,
+      0,
+      iroha::ametsuchi::SegmentedLog::kDefaultSegmentSize,
+      log_manager->getChild("SegmentedLog")->getLogger());
+  if (not segmented_log) {
+    log->error("Unable to create segmented log block store");
+    return EXIT_FAILURE;
+  }
+  if ((*segmented_log)->size() != 0) {
+    log->error("Segmented log block store {} is not empty",
+               FLAGS_segmented_log_dir);
+    return EXIT_FAILURE;
+  }
+
+  shared_model::proto::ProtoBlockJsonConverter converter;
+  bool succeeded = true;
+  size_t copied = 0;
+  (*flat_file)->forEachId([&](auto id) {
+    if (not succeeded) {
+      return;
+    }
+    auto blob = (*flat_file)->get(id);
+    if (not blob) {
+      log->error("Unable to read block {}", id);
+      succeeded = false;
+      return;
+    }
+    converter.deserialize(std::string(blob->begin(), blob->end()))
+        .match(
+            [&](auto &&block) {
+              if (not(*segmented_log)->add(id, block.value->blob().blob())) {
+                log->error("Unable to copy block {}", id);
+                succeeded = false;
+              }
+            },
+            [&](const auto &error) {
+              log->error("Unable to parse block {}: {}", id, error.error);
+              succeeded = false;
+            });
+    if (not succeeded) {
+      return;
+    }
+    if (++copied % 10000 == 0) {
+      log->info("Copied {} blocks", copied);
+    }
+  });
+  if (not succeeded) {
+    return EXIT_FAILURE;
+  }
+
+  log->info("Copied {} blocks to {}", copied, FLAGS_segmented_log_dir);
+  return EXIT_SUCCESS;
+}
@@ -31,6 +31,12 @@ ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service) {
   return *this;
 }
 
+ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service,
+                                   AsyncStart async_start) {
+  async_starts_.push_back(std::move(async_start));
+  return append(std::move(service));
+}
+
 iroha::expected::Result<int, std::string> ServerRunner::run() {
   grpc::ServerBuilder builder;
   int selected_port = 0;
@@ -52,6 +58,10 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   // enable retry policy
   builder.AddChannelArgument(GRPC_ARG_ENABLE_RETRIES, 1);
 
+  if (not async_starts_.empty()) {
+    completion_queue_ = builder.AddCompletionQueue();
+  }
+
   server_instance_ = builder.BuildAndStart();
   server_instance_cv_.notify_one();
 
@@ -60,6 +70,19 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
         (boost::format(kPortBindError) % server_address_).str());
   }
 
+  if (completion_queue_) {
+    for (auto &async_start : async_starts_) {
+      async_stops_.push_back(async_start(completion_queue_.get()));
+    }
+    completion_queue_thread_ = std::thread([this] {
+      void *tag;
+      bool ok;
+      while (completion_queue_->Next(&tag, &ok)) {
+        (*static_cast<CompletionHandler *>(tag))(ok);
+      }
+    });
+  }
+
   return iroha::expected::makeValue(selected_port);
 }
 
@@ -90,9 +113,22 @@ void ServerRunner::addListeningPortToBuilder(grpc::ServerBuilder &builder,
   }
 }
 
+void ServerRunner::stopCompletionQueue() {
+  if (completion_queue_thread_.joinable()) {
+    // handlers still running on the polling thread must not start new
+    // operations on the queue once it is shut down
+    for (auto &async_stop : async_stops_) {
+      async_stop();
+    }
+    completion_queue_->Shutdown();
+    completion_queue_thread_.join();
+  }
+}
+
 void ServerRunner::shutdown() {
   if (server_instance_) {
     server_instance_->Shutdown();
+    stopCompletionQueue();
   } else {
     log_->warn("Tried to shutdown without a server instance");
   }
@@ -102,6 +138,7 @@ void ServerRunner::shutdown(
     const std::chrono::system_clock::time_point &deadline) {
   if (server_instance_) {
     server_instance_->Shutdown(deadline);
+    stopCompletionQueue();
   } else {
     log_->warn("Tried to shutdown without a server instance");
   }
@@ -6,6 +6,9 @@
 #ifndef MAIN_SERVER_RUNNER_HPP
 #define MAIN_SERVER_RUNNER_HPP
 
+#include <functional>
+#include <thread>
+
 #include <grpc++/grpc++.h>
 #include <grpc++/impl/codegen/service_type.h>
 #include "common/result.hpp"
@@ -17,6 +20,23 @@
  */
 class ServerRunner {
  public:
+  /**
+   * Stops starting operations on the completion queue of the server. Called
+   * after the server is shut down and before the queue is
+   */
+  using AsyncStop = std::function<void()>;
+
+  /**
+   * Starts serving asynchronous methods of a service on the completion queue
+   * of the server. Every tag placed on the queue must point to a
+   * CompletionHandler, which is called on the polling thread of the queue
+   * with the result of the operation
+   */
+  using AsyncStart = std::function<AsyncStop(grpc::ServerCompletionQueue *)>;
+
+  /// Handler of an operation on the completion queue
+  using CompletionHandler = std::function<void(bool)>;
+
   /**
    * Constructor. Initialize a new instance of ServerRunner class.
    * @param address - the address the server will be bind to in URI form
@@ -39,6 +59,18 @@ class ServerRunner {
    */
   ServerRunner &append(std::shared_ptr<grpc::Service> service);
 
+  /**
+   * Adds a new grpc service with asynchronous methods to be run. The
+   * completion queue of the server is polled by a single thread until the
+   * server is shut down.
+   * @param service - service to append, its asynchronous methods must be
+   * marked before
+   * @param async_start - starts serving the asynchronous methods
+   * @return reference to this with service appended
+   */
+  ServerRunner &append(std::shared_ptr<grpc::Service> service,
+                       AsyncStart async_start);
+
   /**
    * Initialize the server and run main loop.
    * @return Result with used port number or error message
@@ -77,6 +109,12 @@ class ServerRunner {
   void addListeningPortToBuilder(grpc::ServerBuilder &builder,
                                  int *selected_port);
 
+  /**
+   * Shut down the completion queue and wait for the polling thread, must be
+   * called after the server is shut down
+   */
+  void stopCompletionQueue();
+
   logger::LoggerPtr log_;
 
   std::unique_ptr<grpc::Server> server_instance_;
@@ -86,7 +124,12 @@ class ServerRunner {
   std::string server_address_;
   bool reuse_;
   std::vector<std::shared_ptr<grpc::Service>> services_;
+  std::vector<AsyncStart> async_starts_;
+  std::vector<AsyncStop> async_stops_;
   boost::optional<TlsKeypair> tls_keypair_;
+
+  std::unique_ptr<grpc::ServerCompletionQueue> completion_queue_;
+  std::thread completion_queue_thread_;
 };
 
 #endif  // MAIN_SERVER_RUNNER_HPP
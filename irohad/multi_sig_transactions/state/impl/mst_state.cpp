@@ -5,6 +5,7 @@
 
 #include "multi_sig_transactions/state/mst_state.hpp"
 
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/combine.hpp>
 #include "common/set.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 
@@ -84,9 +86,37 @@ namespace iroha {
     for (auto &&rhs_tx : rhs.batches_.right | boost::adaptors::map_keys) {
       insertOne(state_update, rhs_tx);
     }
+    if (rhs.signature_deltas_.empty()) {
+      return state_update;
+    }
+
+    std::unordered_map<shared_model::interface::types::HashType,
+                       DataType,
+                       iroha::model::BlobHasher>
+        batches_by_hash;
+    for (auto &&batch : batches_.right | boost::adaptors::map_keys) {
+      batches_by_hash.emplace(batch->reducedHash(), batch);
+    }
+    for (const auto &delta : rhs.signature_deltas_) {
+      auto found = batches_by_hash.find(delta.reduced_hash);
+      if (found == batches_by_hash.end() or not contains(found->second)) {
+        log_->info("No batch with reduced hash {} for received signatures",
+                   delta.reduced_hash.hex());
+        continue;
+      }
+      insertSignatures(state_update, found->second, delta);
+    }
     return state_update;
   }
 
+  void MstState::attachSignatures(SignatureDelta delta) {
+    signature_deltas_.push_back(std::move(delta));
+  }
+
+  const std::vector<SignatureDelta> &MstState::signatureDeltas() const {
+    return signature_deltas_;
+  }
+
   MstState MstState::operator-(const MstState &rhs) const {
     const auto &my_batches = batches_.right | boost::adaptors::map_keys;
     std::vector<DataType> difference;
@@ -100,7 +130,7 @@ namespace iroha {
   }
 
   bool MstState::isEmpty() const {
-    return batches_.empty();
+    return batches_.empty() and signature_deltas_.empty();
   }
 
   std::unordered_set<DataType,
@@ -174,19 +204,80 @@ namespace iroha {
     DataType found = corresponding->first;
     // Append new signatures to the existing state
     auto inserted_new_signatures = mergeSignaturesInBatch(found, rhs_batch);
+    publishUpdate(state_update, found, inserted_new_signatures);
+  }
+
+  void MstState::insertSignatures(StateUpdateResult &state_update,
+                                  const DataType &batch,
+                                  const SignatureDelta &delta) {
+    const auto &transactions = batch->transactions();
+    if (delta.signatures.size() != transactions.size()) {
+      log_->warn("Received signatures of {} transactions for batch {}",
+                 delta.signatures.size(),
+                 *batch);
+      return;
+    }
+
+    // transactions received from other peers are validated by the transport,
+    // their signatures received alone are verified here against the payload
+    std::vector<std::pair<size_t, const SignatureDelta::TxSignature *>>
+        new_signatures;
+    shared_model::crypto::VerificationBatch verification;
+    for (size_t i = 0; i < transactions.size(); ++i) {
+      const auto &tx = transactions[i];
+      for (const auto &signature : delta.signatures[i]) {
+        auto signatures = tx->signatures();
+        if (std::none_of(signatures.begin(),
+                         signatures.end(),
+                         [&signature](const auto &present) {
+                           return present.publicKey() == signature.public_key;
+                         })) {
+          new_signatures.emplace_back(i, &signature);
+          verification.emplace_back(
+              signature.signed_data, tx->payload(), signature.public_key);
+        }
+      }
+    }
+
+    auto failures =
+        shared_model::crypto::CryptoVerifier<>::verifyBatch(verification);
+    if (not failures.empty()) {
+      log_->warn("Dropping {} wrong signatures of batch {}",
+                 failures.size(),
+                 batch->reducedHash().hex());
+    }
+    auto failure = failures.begin();
+    auto inserted_new_signatures = false;
+    for (size_t i = 0; i < new_signatures.size(); ++i) {
+      if (failure != failures.end() and *failure == i) {
+        ++failure;
+        continue;
+      }
+      const auto &signature = *new_signatures[i].second;
+      inserted_new_signatures =
+          batch->addSignature(new_signatures[i].first,
+                              signature.signed_data,
+                              signature.public_key)
+          or inserted_new_signatures;
+    }
+    publishUpdate(state_update, batch, inserted_new_signatures);
+  }
 
-    if (completer_->isCompleted(found)) {
+  void MstState::publishUpdate(StateUpdateResult &state_update,
+                               const DataType &batch,
+                               bool inserted_new_signatures) {
+    if (completer_->isCompleted(batch)) {
       // state already has completed transaction,
       // remove from state and return it
-      batches_.right.erase(found);
-      state_update.completed_state_->rawInsert(found);
+      batches_.right.erase(batch);
+      state_update.completed_state_->rawInsert(batch);
       return;
     }
 
     // if batch still isn't completed, return it, if new signatures were
     // inserted
     if (inserted_new_signatures) {
-      state_update.updated_state_->rawInsert(found);
+      state_update.updated_state_->rawInsert(batch);
     }
   }
 
@@ -18,6 +18,8 @@
 #include <boost/optional/optional.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/any_range.hpp>
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
@@ -86,6 +88,23 @@ namespace iroha {
 
   using CompleterType = std::shared_ptr<const Completer>;
 
+  /**
+   * New signatures of a batch, which are sent instead of the whole batch to a
+   * peer known to have it
+   */
+  struct SignatureDelta {
+    /// Signature of a transaction
+    struct TxSignature {
+      shared_model::crypto::Signed signed_data;
+      shared_model::crypto::PublicKey public_key;
+    };
+
+    /// reduced hash of the batch
+    shared_model::interface::types::HashType reduced_hash;
+    /// signatures of each transaction of the batch, in the batch order
+    std::vector<std::vector<TxSignature>> signatures;
+  };
+
   class MstState {
    public:
     // -----------------------------| public api |------------------------------
@@ -107,14 +126,29 @@ namespace iroha {
     StateUpdateResult operator+=(const DataType &rhs);
 
     /**
-     * Concat internal data of states
+     * Concat internal data of states. Signature deltas attached to rhs are
+     * added to the batches of this state, signatures which do not match the
+     * transactions are dropped
      * @param rhs - object for merging
      * @return States with completed and updated batches
      */
     StateUpdateResult operator+=(const MstState &rhs);
 
     /**
-     * Operator provide difference between this and rhs operator
+     * Attach new signatures of a batch to the state. They are added to the
+     * batch when the state is merged into a state which has the batch
+     * @param delta - new signatures of the batch
+     */
+    void attachSignatures(SignatureDelta delta);
+
+    /**
+     * @return signature deltas attached to the state
+     */
+    const std::vector<SignatureDelta> &signatureDeltas() const;
+
+    /**
+     * Operator provide difference between this and rhs operator. Attached
+     * signature deltas are not a part of the difference
      * @param rhs, state for removing
      * @return State that provide difference between left and right states
      * axiom operators:
@@ -124,7 +158,7 @@ namespace iroha {
     MstState operator-(const MstState &rhs) const;
 
     /**
-     * @return true, if there is no batches inside
+     * @return true, if there is no batches and signature deltas inside
      */
     bool isEmpty() const;
 
@@ -173,6 +207,22 @@ namespace iroha {
       }
     }
 
+    /**
+     * Make a state of the batches which satisfy the predicate
+     * @param predicate - called with each batch of the state
+     * @return state with the selected batches and no signature deltas
+     */
+    template <typename Predicate>
+    MstState filter(const Predicate &predicate) const {
+      std::vector<DataType> selected;
+      iterateBatches([&predicate, &selected](const auto &batch) {
+        if (predicate(batch)) {
+          selected.push_back(batch);
+        }
+      });
+      return MstState(completer_, selected, log_);
+    }
+
    private:
     // --------------------------| private api |------------------------------
 
@@ -200,6 +250,28 @@ namespace iroha {
      */
     void insertOne(StateUpdateResult &state_update, const DataType &rhs_tx);
 
+    /**
+     * Add verified signatures of the delta to the batch of the state and push
+     * the batch in out_completed_state or out_updated_state
+     * @param state_update consists of states with updated and completed batches
+     * @param batch - batch of the state with the reduced hash of the delta
+     * @param delta - new signatures of the batch
+     */
+    void insertSignatures(StateUpdateResult &state_update,
+                          const DataType &batch,
+                          const SignatureDelta &delta);
+
+    /**
+     * Push the batch with new signatures in out_completed_state, removing it
+     * from the state, if it is completed, or in out_updated_state otherwise
+     * @param state_update consists of states with updated and completed batches
+     * @param batch - batch of the state
+     * @param inserted_new_signatures - whether the batch got new signatures
+     */
+    void publishUpdate(StateUpdateResult &state_update,
+                       const DataType &batch,
+                       bool inserted_new_signatures);
+
     /**
      * Insert new value in state with keeping invariant
      * @param rhs_tx - data for insertion
@@ -220,6 +292,8 @@ namespace iroha {
 
     BatchesBimap batches_;
 
+    std::vector<SignatureDelta> signature_deltas_;
+
     logger::LoggerPtr log_;
   };
 
@@ -5,20 +5,44 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
+#include "interfaces/transaction.hpp"
+
 namespace iroha {
   // ------------------------------| private API |------------------------------
 
-  auto MstStorageStateImpl::getState(
-      const shared_model::crypto::PublicKey &target_peer_key) {
-    auto target_state_iter = peer_states_.find(target_peer_key);
-    if (target_state_iter == peer_states_.end()) {
-      return peer_states_
-          .insert(
-              {target_peer_key, MstState::empty(mst_state_logger_, completer_)})
-          .first;
+  void MstStorageStateImpl::addSignatory(
+      BatchSignatories &known,
+      size_t tx_number,
+      const shared_model::crypto::PublicKey &public_key) {
+    if (known.size() <= tx_number) {
+      known.resize(tx_number + 1);
+    }
+    known[tx_number].insert(public_key);
+  }
+
+  boost::optional<SignatureDelta> MstStorageStateImpl::newSignatures(
+      const DataType &batch, const BatchSignatories &known) {
+    SignatureDelta delta{batch->reducedHash(), {}};
+    bool has_new_signatures = false;
+    for (const auto &tx : batch->transactions()) {
+      const auto tx_number = delta.signatures.size();
+      delta.signatures.emplace_back();
+      for (const auto &signature : tx->signatures()) {
+        if (tx_number < known.size()
+            and known[tx_number].count(signature.publicKey()) != 0) {
+          continue;
+        }
+        delta.signatures.back().push_back(
+            {signature.signedData(), signature.publicKey()});
+        has_new_signatures = true;
+      }
+    }
+    if (not has_new_signatures) {
+      return boost::none;
     }
-    return target_state_iter;
+    return delta;
   }
+
   // -----------------------------| interface API |-----------------------------
 
   MstStorageStateImpl::MstStorageStateImpl(const CompleterType &completer,
@@ -33,8 +57,24 @@ namespace iroha {
       const shared_model::crypto::PublicKey &target_peer_key,
       const MstState &new_state)
       -> decltype(apply(target_peer_key, new_state)) {
-    auto target_state_iter = getState(target_peer_key);
-    target_state_iter->second += new_state;
+    auto &peer_state = peer_states_[target_peer_key];
+    new_state.iterateBatches([&peer_state](const auto &batch) {
+      auto &known = peer_state[batch->reducedHash()];
+      const auto &transactions = batch->transactions();
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        for (const auto &signature : transactions[i]->signatures()) {
+          addSignatory(known, i, signature.publicKey());
+        }
+      }
+    });
+    for (const auto &delta : new_state.signatureDeltas()) {
+      auto &known = peer_state[delta.reduced_hash];
+      for (size_t i = 0; i < delta.signatures.size(); ++i) {
+        for (const auto &signature : delta.signatures[i]) {
+          addSignatory(known, i, signature.public_key);
+        }
+      }
+    }
     return own_state_ += new_state;
   }
 
@@ -46,19 +86,44 @@ namespace iroha {
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(extractExpiredTransactions(current_time)) {
-    for (auto &peer_and_state : peer_states_) {
-      peer_and_state.second.eraseExpired(current_time);
-    }
-    return own_state_.extractExpired(current_time);
+    auto expired_state = own_state_.extractExpired(current_time);
+    expired_state.iterateBatches([this](const auto &batch) {
+      for (auto &peer_and_state : peer_states_) {
+        peer_and_state.second.erase(batch->reducedHash());
+      }
+    });
+    return expired_state;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
       const TimeType &current_time)
       -> decltype(getDiffState(target_peer_key, current_time)) {
-    auto target_current_state_iter = getState(target_peer_key);
-    auto new_diff_state = own_state_ - target_current_state_iter->second;
-    new_diff_state.eraseExpired(current_time);
+    auto &peer_state = peer_states_[target_peer_key];
+    // the peer is assumed to have only the signatures it has sent, so new
+    // signatures are repeated until the batch is completed or expired
+    PeerState actual_peer_state;
+    std::vector<SignatureDelta> deltas;
+    auto new_diff_state = own_state_.filter([&](const auto &batch) {
+      if (completer_->isExpired(batch, current_time)) {
+        return false;
+      }
+      auto known = peer_state.find(batch->reducedHash());
+      if (known == peer_state.end()) {
+        return true;
+      }
+      if (auto delta = newSignatures(batch, known->second)) {
+        deltas.push_back(std::move(*delta));
+      }
+      actual_peer_state.insert(std::move(*known));
+      return false;
+    });
+    // batches which left own state are forgotten
+    peer_state = std::move(actual_peer_state);
+
+    for (auto &delta : deltas) {
+      new_diff_state.attachSignatures(std::move(delta));
+    }
     return new_diff_state;
   }
 
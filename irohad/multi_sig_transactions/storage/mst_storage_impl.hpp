@@ -7,22 +7,53 @@
 #define IROHA_MST_STORAGE_IMPL_HPP
 
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
 namespace iroha {
+  /**
+   * Storage, which remembers signatures of the batches received from each peer.
+   * Batches unknown to a peer are sent to it whole, and the batches it has are
+   * sent as signature deltas
+   */
   class MstStorageStateImpl : public MstStorage {
    private:
     // -----------------------------| private API |-----------------------------
 
+    /// Public keys of signatures of each transaction of a batch
+    using BatchSignatories =
+        std::vector<std::unordered_set<shared_model::crypto::PublicKey,
+                                       iroha::model::BlobHasher>>;
+
+    /// Signatories of the batches a peer has, by reduced hash of the batch
+    using PeerState =
+        std::unordered_map<shared_model::interface::types::HashType,
+                           BatchSignatories,
+                           iroha::model::BlobHasher>;
+
+    /**
+     * Remember the signatory of the transaction as known to a peer
+     * @param known - signatories of the batch known to the peer
+     * @param tx_number - number of the transaction in the batch
+     * @param public_key - signatory of the transaction
+     */
+    static void addSignatory(BatchSignatories &known,
+                             size_t tx_number,
+                             const shared_model::crypto::PublicKey &public_key);
+
     /**
-     * Return state of a peer by its public key. If state doesn't exist, create
-     * new empty state and return it.
-     * @param target_peer_key - public key of the peer for searching
-     * @return valid iterator for state of peer
+     * Collect signatures of the batch which the peer does not have
+     * @param batch - batch of own state
+     * @param known - signatories of the batch known to the peer
+     * @return new signatures or none if the peer has all of them
      */
-    auto getState(const shared_model::crypto::PublicKey &target_peer_key);
+    static boost::optional<SignatureDelta> newSignatures(
+        const DataType &batch, const BatchSignatories &known);
 
    public:
     // ----------------------------| interface API |----------------------------
@@ -55,7 +86,7 @@ namespace iroha {
 
     const CompleterType completer_;
     std::unordered_map<shared_model::crypto::PublicKey,
-                       MstState,
+                       PeerState,
                        iroha::model::BlobHasher>
         peer_states_;
     MstState own_state_;
@@ -7,8 +7,6 @@
 
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -36,6 +34,8 @@ void sendStateAsyncImpl(
 MstTransportGrpc::MstTransportGrpc(
     std::shared_ptr<AsyncGrpcClient<google::protobuf::Empty>> async_call,
     std::shared_ptr<TransportFactoryType> transaction_factory,
+    std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+        transaction_builder,
     std::shared_ptr<shared_model::interface::TransactionBatchParser>
         batch_parser,
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -48,6 +48,7 @@ MstTransportGrpc::MstTransportGrpc(
     boost::optional<SenderFactory> sender_factory)
     : async_call_(std::move(async_call)),
       transaction_factory_(std::move(transaction_factory)),
+      transaction_builder_(std::move(transaction_builder)),
       batch_parser_(std::move(batch_parser)),
       batch_factory_(std::move(transaction_batch_factory)),
       tx_presence_cache_(std::move(tx_presence_cache)),
@@ -59,27 +60,20 @@ MstTransportGrpc::MstTransportGrpc(
 
 shared_model::interface::types::SharedTxsCollectionType
 MstTransportGrpc::deserializeTransactions(const transport::MstState *request) {
-  return boost::copy_range<
-      shared_model::interface::types::SharedTxsCollectionType>(
-      request->transactions()
-      | boost::adaptors::transformed(
-            [&](const auto &tx) { return transaction_factory_->build(tx); })
-      | boost::adaptors::filtered([&](const auto &result) {
-          return result.match(
-              [](const auto &) { return true; },
-              [&](const auto &error) {
-                log_->info("Transaction deserialization failed: hash {}, {}",
-                           error.error.hash,
-                           error.error.error);
-                return false;
-              });
-        })
-      | boost::adaptors::transformed([&](auto result) {
-          return std::move(
-                     boost::get<iroha::expected::ValueOf<decltype(result)>>(
-                         result))
-              .value;
-        }));
+  shared_model::interface::types::SharedTxsCollectionType tx_collection;
+  for (auto &result : transaction_builder_->build(*transaction_factory_,
+                                                  request->transactions())) {
+    std::move(result).match(
+        [&tx_collection](auto &&v) {
+          tx_collection.emplace_back(std::move(v).value);
+        },
+        [this](const auto &error) {
+          log_->info("Transaction deserialization failed: hash {}, {}",
+                     error.error.hash,
+                     error.error.error);
+        });
+  }
+  return tx_collection;
 }
 
 grpc::Status MstTransportGrpc::SendState(
@@ -123,7 +117,27 @@ grpc::Status MstTransportGrpc::SendState(
         });
   }
 
-  log_->info("batches in MstState: {}", new_state.getBatches().size());
+  for (const auto &proto_delta : request->signature_deltas()) {
+    SignatureDelta delta{
+        shared_model::crypto::Hash(proto_delta.reduced_hash()), {}};
+    for (const auto &proto_tx : proto_delta.transactions()) {
+      delta.signatures.emplace_back();
+      for (const auto &signature : proto_tx.signatures()) {
+        delta.signatures.back().push_back(
+            {shared_model::crypto::Signed(
+                 shared_model::crypto::Blob::fromHexString(
+                     signature.signature())),
+             shared_model::crypto::PublicKey(
+                 shared_model::crypto::Blob::fromHexString(
+                     signature.public_key()))});
+      }
+    }
+    new_state.attachSignatures(std::move(delta));
+  }
+
+  log_->info("batches in MstState: {}, signature deltas: {}",
+             new_state.getBatches().size(),
+             new_state.signatureDeltas().size());
 
   shared_model::crypto::PublicKey source_key(request->source_peer_key());
   auto key_invalid_reason =
@@ -188,6 +202,19 @@ void sendStateAsyncImpl(const shared_model::interface::Peer &to,
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
             ->getTransport();
   });
+  for (const auto &delta : state.signatureDeltas()) {
+    auto proto_delta = protoState.add_signature_deltas();
+    proto_delta->set_reduced_hash(
+        shared_model::crypto::toBinaryString(delta.reduced_hash));
+    for (const auto &tx_signatures : delta.signatures) {
+      auto proto_tx = proto_delta->add_transactions();
+      for (const auto &signature : tx_signatures) {
+        auto proto_signature = proto_tx->add_signatures();
+        proto_signature->set_signature(signature.signed_data.hex());
+        proto_signature->set_public_key(signature.public_key.hex());
+      }
+    }
+  }
   async_call.Call([&](auto context, auto cq) {
     return client->AsyncSendState(context, protoState, cq);
   });
@@ -12,6 +12,7 @@
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "logger/logger_fwd.hpp"
@@ -40,6 +41,8 @@ namespace iroha {
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
           std::shared_ptr<TransportFactoryType> transaction_factory,
+          std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+              transaction_builder,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
           std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -80,6 +83,8 @@ namespace iroha {
       std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
           async_call_;
       std::shared_ptr<TransportFactoryType> transaction_factory_;
+      std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+          transaction_builder_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
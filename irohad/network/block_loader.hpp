@@ -7,6 +7,8 @@
 #define IROHA_BLOCK_LOADER_HPP
 
 #include <memory>
+#include <vector>
+
 #include <rxcpp/rx-observable-fwd.hpp>
 
 #include "cryptography/public_key.hpp"
@@ -30,6 +32,22 @@ namespace iroha {
       retrieveBlocks(const shared_model::interface::types::HeightType height,
                      const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve a range of blocks from given peer. Blocks are read on the
+       * calling thread, so several ranges may be retrieved concurrently
+       * @param peer_pubkey - peer for requesting blocks
+       * @param first_height - height of the first block of the range
+       * @param last_height - height of the last block of the range
+       * @return all blocks of the range in height order, nullopt if some of
+       * them could not be retrieved
+       */
+      virtual boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Block>>>
+      retrieveBlockRange(
+          const shared_model::crypto::PublicKey &peer_pubkey,
+          shared_model::interface::types::HeightType first_height,
+          shared_model::interface::types::HeightType last_height) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
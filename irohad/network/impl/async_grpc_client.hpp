@@ -7,6 +7,7 @@
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
 #include <ciso646>
+#include <functional>
 #include <thread>
 
 #include <google/protobuf/empty.pb.h>
@@ -18,7 +19,8 @@ namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client, server responses are passed to the handler of
+     * the call if it is provided
      * @tparam Response type of server response
      */
     template <typename Response>
@@ -39,6 +41,9 @@ namespace iroha {
           if (not call->status.ok()) {
             log_->warn("RPC failed: {}", call->status.error_message());
           }
+          if (call->on_response) {
+            call->on_response(call->status, call->reply);
+          }
           delete call;
         }
       }
@@ -65,6 +70,9 @@ namespace iroha {
 
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Response>>
             response_reader;
+
+        std::function<void(const grpc::Status &, const Response &)>
+            on_response;
       };
 
       /**
@@ -74,7 +82,22 @@ namespace iroha {
        */
       template <typename F>
       void Call(F &&lambda) {
+        Call(std::forward<F>(lambda), nullptr);
+      }
+
+      /**
+       * Perform the call and pass server response to the handler
+       * @tparam lambda which must return unique pointer to
+       * ClientAsyncResponseReader<Response> object
+       * @param on_response - handler of call status and server response,
+       * which is invoked from the completion queue thread
+       */
+      template <typename F>
+      void Call(F &&lambda,
+                std::function<void(const grpc::Status &, const Response &)>
+                    on_response) {
         auto call = new AsyncClientCall;
+        call->on_response = std::move(on_response);
         call->response_reader = lambda(&call->context, &cq_);
         call->response_reader->Finish(&call->reply, &call->status, call);
       }
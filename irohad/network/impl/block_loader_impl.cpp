@@ -26,6 +26,7 @@ namespace {
   const char *kPeerRetrieveFail = "Failed to retrieve peers";
   const char *kPeerFindFail = "Failed to find requested peer";
   const std::chrono::seconds kBlocksRequestTimeout{5};
+  const std::chrono::seconds kBlockRangeRequestTimeout{30};
 }  // namespace
 
 BlockLoaderImpl::BlockLoaderImpl(
@@ -77,6 +78,69 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
       });
 }
 
+boost::optional<std::vector<std::shared_ptr<Block>>>
+BlockLoaderImpl::retrieveBlockRange(const PublicKey &peer_pubkey,
+                                    types::HeightType first_height,
+                                    types::HeightType last_height) {
+  auto peer = findPeer(peer_pubkey);
+  if (not peer) {
+    log_->error("{}", kPeerNotFound);
+    return boost::none;
+  }
+
+  proto::BlockRequest request;
+  grpc::ClientContext context;
+  protocol::Block block;
+
+  context.set_deadline(std::chrono::system_clock::now()
+                       + kBlockRangeRequestTimeout);
+
+  request.set_height(first_height);
+  request.set_last_height(last_height);
+
+  const size_t count = last_height - first_height + 1;
+  std::vector<std::shared_ptr<Block>> blocks;
+  blocks.reserve(count);
+  auto reader = getPeerStub(**peer).retrieveBlocks(&context, request);
+  bool failed = false;
+  while (not failed and blocks.size() < count and reader->Read(&block)) {
+    block_factory_.createBlock(std::move(block))
+        .match(
+            [&](auto &&result) {
+              auto expected_height = first_height + blocks.size();
+              if (result.value->height() != expected_height) {
+                log_->error("Peer {} sent block {} instead of {}",
+                            (*peer)->address(),
+                            result.value->height(),
+                            expected_height);
+                failed = true;
+                return;
+              }
+              blocks.emplace_back(std::move(result.value));
+            },
+            [&](const auto &error) {
+              log_->error("{}", error.error);
+              failed = true;
+            });
+  }
+  // peers which ignore last_height keep streaming up to their top
+  if (failed or blocks.size() == count) {
+    context.TryCancel();
+  }
+  auto status = reader->Finish();
+
+  if (failed or blocks.size() != count) {
+    log_->warn("Retrieved {} of blocks {} to {} from peer {}: {}",
+               blocks.size(),
+               first_height,
+               last_height,
+               (*peer)->address(),
+               status.error_message());
+    return boost::none;
+  }
+  return blocks;
+}
+
 boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     const PublicKey &peer_pubkey, types::HeightType block_height) {
   auto peer = findPeer(peer_pubkey);
@@ -133,6 +197,7 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
 
 proto::Loader::StubInterface &BlockLoaderImpl::getPeerStub(
     const shared_model::interface::Peer &peer) {
+  std::lock_guard<std::mutex> lock(peer_connections_mutex_);
   auto it = peer_connections_.find(peer.address());
   if (it == peer_connections_.end()) {
     it = peer_connections_
@@ -8,6 +8,7 @@
 
 #include "network/block_loader.hpp"
 
+#include <mutex>
 #include <unordered_map>
 
 #include "ametsuchi/peer_query_factory.hpp"
@@ -30,6 +31,13 @@ namespace iroha {
           const shared_model::interface::types::HeightType height,
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      boost::optional<
+          std::vector<std::shared_ptr<shared_model::interface::Block>>>
+      retrieveBlockRange(
+          const shared_model::crypto::PublicKey &peer_pubkey,
+          shared_model::interface::types::HeightType first_height,
+          shared_model::interface::types::HeightType last_height) override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
@@ -52,6 +60,7 @@ namespace iroha {
       proto::Loader::StubInterface &getPeerStub(
           const shared_model::interface::Peer &peer);
 
+      std::mutex peer_connections_mutex_;
       std::unordered_map<shared_model::interface::types::AddressType,
                          std::unique_ptr<proto::Loader::StubInterface>>
           peer_connections_;
@@ -5,6 +5,8 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <algorithm>
+
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
@@ -52,6 +54,10 @@ grpc::Status BlockLoaderService::retrieveBlocks(
   }
 
   auto top_height = (*block_query)->getTopBlockHeight();
+  if (request->last_height() != 0) {
+    top_height = std::min<decltype(top_height)>(top_height,
+                                                request->last_height());
+  }
   for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
     auto block_result = (*block_query)->getBlock(i);
 
@@ -60,14 +66,13 @@ grpc::Status BlockLoaderService::retrieveBlocks(
     }
 
     auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
+        boost::get<expected::ValueOf<decltype(block_result)>>(block_result)
             .value;
 
     protocol::Block proto_block;
     *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
+        static_cast<const shared_model::proto::Block *>(block.get())
+            ->getTransport();
 
     writer->Write(proto_block);
   }
@@ -121,7 +126,8 @@ grpc::Status BlockLoaderService::retrieveBlock(
       boost::get<expected::ValueOf<decltype(block_result)>>(block_result).value;
 
   const auto &block_v1 =
-      static_cast<shared_model::proto::Block *>(block.get())->getTransport();
+      static_cast<const shared_model::proto::Block *>(block.get())
+          ->getTransport();
   *response->mutable_block_v1() = block_v1;
   return grpc::Status::OK;
 }
@@ -0,0 +1,41 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_BATCHES_PACKING_POLICY_HPP
+#define IROHA_ORDERING_BATCHES_PACKING_POLICY_HPP
+
+#include <vector>
+
+#include "ordering/on_demand_os_transport.hpp"
+#include "ordering/packing_policy_type.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Class provides a policy of selecting pending batches for a proposal
+     */
+    class BatchesPackingPolicy {
+     public:
+      using BatchType = transport::OdOsNotification::TransactionBatchType;
+      using BatchesCollectionType = std::vector<BatchType>;
+
+      /**
+       * Select batches for the next proposal
+       * @param candidates - batches available for packing in order of arrival
+       * @param max_transactions - maximum number of transactions in proposal
+       * @return selected batches in the order they appear in proposal
+       */
+      virtual BatchesCollectionType pack(
+          const BatchesCollectionType &candidates,
+          size_t max_transactions) const = 0;
+
+      virtual ~BatchesPackingPolicy() = default;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_BATCHES_PACKING_POLICY_HPP
@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batches_mempool.hpp"
+
+#include <algorithm>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+BatchesMempool::BatchesMempool(size_t max_transactions,
+                               std::chrono::milliseconds batch_lifetime)
+    : max_transactions_(max_transactions),
+      batch_lifetime_(batch_lifetime),
+      transactions_count_(0),
+      taking_number_(0) {}
+
+bool BatchesMempool::insert(BatchType batch, TimestampType arrival_time) {
+  const auto &transactions = batch->transactions();
+  if (transactions.size() > max_transactions_
+      or batches_index_.count(batch->reducedHash()) != 0
+      or std::any_of(transactions.begin(),
+                     transactions.end(),
+                     [this](const auto &tx) {
+                       return transactions_index_.count(tx->hash()) != 0;
+                     })) {
+    return false;
+  }
+
+  while (transactions_count_ + transactions.size() > max_transactions_) {
+    erase(entries_.begin());
+  }
+
+  auto it = entries_.insert(entries_.end(), Entry{batch, arrival_time, 0});
+  batches_index_.emplace(batch->reducedHash(), it);
+  for (const auto &tx : transactions) {
+    transactions_index_.emplace(tx->hash(), batch->reducedHash());
+  }
+  transactions_count_ += transactions.size();
+  return true;
+}
+
+void BatchesMempool::remove(const HashesSetType &tx_hashes) {
+  for (const auto &hash : tx_hashes) {
+    auto tx_it = transactions_index_.find(hash);
+    if (tx_it == transactions_index_.end()) {
+      continue;
+    }
+    erase(batches_index_.at(tx_it->second));
+  }
+}
+
+size_t BatchesMempool::removeExpired(TimestampType now) {
+  size_t removed = 0;
+  while (not entries_.empty()
+         and entries_.front().arrival_time
+                 + static_cast<TimestampType>(batch_lifetime_.count())
+             < now) {
+    erase(entries_.begin());
+    ++removed;
+  }
+  return removed;
+}
+
+BatchesMempool::TransactionsCollectionType BatchesMempool::takeTransactions(
+    size_t requested_tx_amount, const BatchesPackingPolicy &policy) {
+  ++taking_number_;
+  BatchesPackingPolicy::BatchesCollectionType candidates;
+  for (const auto &entry : entries_) {
+    // batch is in the proposal of the current round
+    if (entry.taken_at == 0 or entry.taken_at + 1 != taking_number_) {
+      candidates.push_back(entry.batch);
+    }
+  }
+
+  TransactionsCollectionType collection;
+  for (const auto &batch : policy.pack(candidates, requested_tx_amount)) {
+    const auto &transactions = batch->transactions();
+    collection.insert(
+        collection.end(), transactions.begin(), transactions.end());
+    batches_index_.at(batch->reducedHash())->taken_at = taking_number_;
+  }
+  return collection;
+}
+
+BatchesMempool::TransactionsCollectionType BatchesMempool::getTransactions(
+    const std::vector<shared_model::crypto::Hash> &tx_hashes) const {
+  TransactionsCollectionType collection;
+  for (const auto &hash : tx_hashes) {
+    auto tx_it = transactions_index_.find(hash);
+    if (tx_it == transactions_index_.end()) {
+      continue;
+    }
+    const auto &transactions =
+        batches_index_.at(tx_it->second)->batch->transactions();
+    auto it = std::find_if(
+        transactions.begin(), transactions.end(), [&hash](const auto &tx) {
+          return tx->hash() == hash;
+        });
+    if (it != transactions.end()) {
+      collection.push_back(*it);
+    }
+  }
+  return collection;
+}
+
+size_t BatchesMempool::batchesCount() const {
+  return entries_.size();
+}
+
+size_t BatchesMempool::transactionsCount() const {
+  return transactions_count_;
+}
+
+bool BatchesMempool::empty() const {
+  return entries_.empty();
+}
+
+void BatchesMempool::erase(EntriesType::iterator it) {
+  const auto &transactions = it->batch->transactions();
+  for (const auto &tx : transactions) {
+    transactions_index_.erase(tx->hash());
+  }
+  transactions_count_ -= transactions.size();
+  batches_index_.erase(it->batch->reducedHash());
+  entries_.erase(it);
+}
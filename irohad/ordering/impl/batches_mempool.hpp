@@ -0,0 +1,140 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_BATCHES_MEMPOOL_HPP
+#define IROHA_ORDERING_BATCHES_MEMPOOL_HPP
+
+#include <chrono>
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "ordering/batches_packing_policy.hpp"
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Storage of batches which wait to be included into a proposal. A batch
+     * is kept across rounds until its transactions are committed or rejected,
+     * its lifetime expires, or it is evicted as the oldest one when capacity
+     * is exceeded. Batches are indexed by reduced hash and ordered by arrival
+     * time.
+     * Note: class is not thread-safe
+     */
+    class BatchesMempool {
+     public:
+      using BatchType = transport::OdOsNotification::TransactionBatchType;
+      using TransactionsCollectionType =
+          std::vector<std::shared_ptr<shared_model::interface::Transaction>>;
+      using HashesSetType =
+          std::unordered_set<shared_model::crypto::Hash,
+                             shared_model::crypto::Hash::Hasher>;
+      using TimestampType = shared_model::interface::types::TimestampType;
+
+      /**
+       * @param max_transactions - maximum number of transactions in all
+       * stored batches, the oldest batches are evicted when it is exceeded
+       * @param batch_lifetime - time since arrival after which a batch expires
+       */
+      BatchesMempool(size_t max_transactions,
+                     std::chrono::milliseconds batch_lifetime);
+
+      /**
+       * Add batch to the mempool
+       * @param batch - batch to add
+       * @param arrival_time - time when the batch was received
+       * @return true if batch was added, false if the batch or some of its
+       * transactions are already stored, or the batch alone exceeds capacity
+       */
+      bool insert(BatchType batch, TimestampType arrival_time);
+
+      /**
+       * Remove batches which contain any of the given transactions
+       * @param tx_hashes - hashes of committed or rejected transactions
+       */
+      void remove(const HashesSetType &tx_hashes);
+
+      /**
+       * Remove batches which have outlived their lifetime
+       * @param now - current time
+       * @return number of removed batches
+       */
+      size_t removeExpired(TimestampType now);
+
+      /**
+       * Take transactions for the next proposals. Does not break batches.
+       * Batches taken by the previous call are skipped, since the proposal
+       * with them is being voted for in the current round. Taken batches stay
+       * in the mempool until they are removed.
+       * @param requested_tx_amount - maximum amount of transactions to take
+       * @param policy - selects batches among the rest in order of arrival
+       * @return transactions
+       */
+      TransactionsCollectionType takeTransactions(
+          size_t requested_tx_amount, const BatchesPackingPolicy &policy);
+
+      /**
+       * Find stored transactions by their hashes
+       * @param tx_hashes - hashes of required transactions
+       * @return found transactions, missing ones are skipped
+       */
+      TransactionsCollectionType getTransactions(
+          const std::vector<shared_model::crypto::Hash> &tx_hashes) const;
+
+      /// @return number of stored batches
+      size_t batchesCount() const;
+
+      /// @return number of transactions in all stored batches
+      size_t transactionsCount() const;
+
+      /// @return true if there are no stored batches
+      bool empty() const;
+
+     private:
+      struct Entry {
+        BatchType batch;
+        TimestampType arrival_time;
+        /// number of the last takeTransactions call which took the batch
+        size_t taken_at;
+      };
+
+      using EntriesType = std::list<Entry>;
+
+      /**
+       * Remove entry together with all its indices
+       */
+      void erase(EntriesType::iterator it);
+
+      size_t max_transactions_;
+      std::chrono::milliseconds batch_lifetime_;
+
+      /// batches in order of arrival
+      EntriesType entries_;
+
+      /// reduced hash of batch -> entry
+      std::unordered_map<shared_model::crypto::Hash,
+                         EntriesType::iterator,
+                         shared_model::crypto::Hash::Hasher>
+          batches_index_;
+
+      /// transaction hash -> reduced hash of its batch
+      std::unordered_map<shared_model::crypto::Hash,
+                         shared_model::crypto::Hash,
+                         shared_model::crypto::Hash::Hasher>
+          transactions_index_;
+
+      size_t transactions_count_;
+      size_t taking_number_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_BATCHES_MEMPOOL_HPP
@@ -0,0 +1,145 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batches_packing_policies.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  size_t batchSize(const BatchesPackingPolicy::BatchType &batch) {
+    return batch->transactions().size();
+  }
+}  // namespace
+
+BatchesPackingPolicy::BatchesCollectionType FifoPackingPolicy::pack(
+    const BatchesCollectionType &candidates, size_t max_transactions) const {
+  BatchesCollectionType result;
+  size_t transactions = 0;
+  for (const auto &batch : candidates) {
+    if (transactions + batchSize(batch) > max_transactions) {
+      break;
+    }
+    transactions += batchSize(batch);
+    result.push_back(batch);
+  }
+  return result;
+}
+
+BatchesPackingPolicy::BatchesCollectionType RoundRobinPackingPolicy::pack(
+    const BatchesCollectionType &candidates, size_t max_transactions) const {
+  // queues of creators in order of their oldest batch arrival
+  std::vector<std::deque<BatchType>> queues;
+  std::unordered_map<std::string, size_t> creators;
+  for (const auto &batch : candidates) {
+    const auto &creator = batch->transactions().front()->creatorAccountId();
+    auto it = creators.emplace(creator, queues.size()).first;
+    if (it->second == queues.size()) {
+      queues.emplace_back();
+    }
+    queues[it->second].push_back(batch);
+  }
+
+  BatchesCollectionType result;
+  size_t transactions = 0;
+  bool taken = true;
+  while (taken) {
+    taken = false;
+    for (auto &queue : queues) {
+      if (queue.empty()) {
+        continue;
+      }
+      if (transactions + batchSize(queue.front()) > max_transactions) {
+        queue.clear();
+        continue;
+      }
+      transactions += batchSize(queue.front());
+      result.push_back(std::move(queue.front()));
+      queue.pop_front();
+      taken = true;
+    }
+  }
+  return result;
+}
+
+KnapsackPackingPolicy::KnapsackPackingPolicy(size_t window_size)
+    : window_size_(window_size) {}
+
+BatchesPackingPolicy::BatchesCollectionType KnapsackPackingPolicy::pack(
+    const BatchesCollectionType &candidates, size_t max_transactions) const {
+  BatchesCollectionType result;
+  if (candidates.empty() or batchSize(candidates.front()) > max_transactions) {
+    return result;
+  }
+
+  // the oldest batch goes first, so it can not be starved by smaller ones
+  result.push_back(candidates.front());
+  const size_t capacity = max_transactions - batchSize(candidates.front());
+
+  auto window_begin = std::next(candidates.begin());
+  auto window_end =
+      std::next(window_begin,
+                std::min(window_size_,
+                         static_cast<size_t>(
+                             std::distance(window_begin, candidates.end()))));
+  const size_t window = std::distance(window_begin, window_end);
+
+  // reachable[i][w] is true if w transactions can be collected from batches
+  // [i, window) of the window
+  std::vector<std::vector<bool>> reachable(
+      window + 1, std::vector<bool>(capacity + 1, false));
+  reachable[window][0] = true;
+  for (size_t i = window; i-- > 0;) {
+    const auto size = batchSize(*std::next(window_begin, i));
+    for (size_t w = 0; w <= capacity; ++w) {
+      reachable[i][w] = reachable[i + 1][w]
+          or (w >= size and reachable[i + 1][w - size]);
+    }
+  }
+
+  size_t fill = capacity;
+  while (not reachable[0][fill]) {
+    --fill;
+  }
+  const size_t window_fill = fill;
+
+  // older batches are preferred among the subsets with the same fill
+  for (size_t i = 0; i < window and fill > 0; ++i) {
+    const auto &batch = *std::next(window_begin, i);
+    const auto size = batchSize(batch);
+    if (size <= fill and reachable[i + 1][fill - size]) {
+      result.push_back(batch);
+      fill -= size;
+    }
+  }
+
+  size_t remaining = capacity - window_fill;
+  for (auto it = window_end; it != candidates.end() and remaining > 0; ++it) {
+    if (batchSize(*it) <= remaining) {
+      remaining -= batchSize(*it);
+      result.push_back(*it);
+    }
+  }
+  return result;
+}
+
+std::shared_ptr<BatchesPackingPolicy> iroha::ordering::createPackingPolicy(
+    PackingPolicyType type) {
+  switch (type) {
+    case PackingPolicyType::kRoundRobin:
+      return std::make_shared<RoundRobinPackingPolicy>();
+    case PackingPolicyType::kKnapsack:
+      return std::make_shared<KnapsackPackingPolicy>();
+    case PackingPolicyType::kFifo:
+    default:
+      return std::make_shared<FifoPackingPolicy>();
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_BATCHES_PACKING_POLICIES_HPP
+#define IROHA_ORDERING_BATCHES_PACKING_POLICIES_HPP
+
+#include "ordering/batches_packing_policy.hpp"
+
+#include <memory>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Takes batches in order of arrival and stops on the first batch which
+     * does not fit, so a large batch is never overtaken by smaller ones
+     */
+    class FifoPackingPolicy : public BatchesPackingPolicy {
+     public:
+      BatchesCollectionType pack(const BatchesCollectionType &candidates,
+                                 size_t max_transactions) const override;
+    };
+
+    /**
+     * Takes one batch of each creator in turn, creators are ordered by the
+     * arrival of their oldest batch. Batches of one creator keep the order of
+     * arrival, so a creator is skipped once its next batch does not fit
+     */
+    class RoundRobinPackingPolicy : public BatchesPackingPolicy {
+     public:
+      BatchesCollectionType pack(const BatchesCollectionType &candidates,
+                                 size_t max_transactions) const override;
+    };
+
+    /**
+     * Always takes the oldest batch, then fills the rest of proposal with the
+     * subset of next batches which gives the largest number of transactions.
+     * Batches beyond the window are added in order of arrival if they fit
+     */
+    class KnapsackPackingPolicy : public BatchesPackingPolicy {
+     public:
+      /**
+       * @param window_size - number of batches following the oldest one which
+       * are considered for the best fill
+       */
+      explicit KnapsackPackingPolicy(size_t window_size = 128);
+
+      BatchesCollectionType pack(const BatchesCollectionType &candidates,
+                                 size_t max_transactions) const override;
+
+     private:
+      size_t window_size_;
+    };
+
+    /**
+     * Create packing policy of the given type
+     */
+    std::shared_ptr<BatchesPackingPolicy> createPackingPolicy(
+        PackingPolicyType type);
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_BATCHES_PACKING_POLICIES_HPP
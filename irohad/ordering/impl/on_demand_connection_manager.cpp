@@ -70,6 +70,19 @@ OnDemandConnectionManager::onRequestProposal(consensus::Round round) {
   return connections_.peers[kIssuer]->onRequestProposal(round);
 }
 
+void OnDemandConnectionManager::onPrefetchProposal(
+    consensus::Round round, ProposalCallbackType callback) {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  log_->debug("onPrefetchProposal, {}", round);
+
+  // issuer of the next commit round receives transactions for it as
+  // kRejectCommitConsumer
+  auto issuer = round.reject_round == kFirstRejectRound ? kRejectCommitConsumer
+                                                        : kNextRejectIssuer;
+  connections_.peers[issuer]->onPrefetchProposal(round, std::move(callback));
+}
+
 void OnDemandConnectionManager::initializeConnections(
     const CurrentPeers &peers) {
   auto create_assign = [this](auto &ptr, auto &peer) {
@@ -27,6 +27,8 @@ namespace iroha {
        * reject round for current block, reject round for next block, and
        * commit for subsequent next round
        * Proposal is requested from the current ordering service: issuer
+       * Proposal for the next reject round is prefetched from its issuer, and
+       * proposal for the next commit round from kRejectCommitConsumer
        */
       enum PeerType {
         kRejectRejectConsumer = 0,
@@ -34,6 +36,7 @@ namespace iroha {
         kCommitRejectConsumer,
         kCommitCommitConsumer,
         kIssuer,
+        kNextRejectIssuer,
         kCount
       };
 
@@ -68,6 +71,14 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      /**
+       * Prefetch proposal for one of the rounds following the current one.
+       * Round with the first reject round number is considered to be the next
+       * commit round, any other round - the next reject round
+       */
+      void onPrefetchProposal(consensus::Round round,
+                              ProposalCallbackType callback) override;
+
      private:
       /**
        * Corresponding connections created by OdOsNotificationFactory
@@ -6,6 +6,7 @@
 #include "ordering/impl/on_demand_ordering_gate.hpp"
 
 #include <iterator>
+#include <vector>
 
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
@@ -38,12 +39,15 @@ OnDemandOrderingGate::OnDemandOrderingGate(
       transaction_limit_(transaction_limit),
       ordering_service_(std::move(ordering_service)),
       network_client_(std::move(network_client)),
+      prefetched_proposals_(std::make_shared<PrefetchedProposals>()),
       processed_tx_hashes_subscription_(
           processed_tx_hashes.subscribe([this](auto hashes) {
             // remove transaction hashes from cache
             log_->debug("Asking to remove {} transactions from cache.",
                         hashes->size());
             cache_->remove(*hashes);
+            // remove pending batches from our ordering service
+            ordering_service_->onTxsCommitted(*hashes);
           })),
       round_switch_subscription_(round_switch_events.subscribe(
           [this,
@@ -58,14 +62,18 @@ OnDemandOrderingGate::OnDemandOrderingGate(
 
             this->sendCachedTransactions();
 
-            // request proposal for the current round
-            auto proposal = this->processProposalRequest(
-                network_client_->onRequestProposal(event.next_round));
+            // request proposal for the current round, unless it has been
+            // prefetched during the previous one
+            auto proposal = this->takePrefetchedProposal(event.next_round);
+            if (not proposal) {
+              proposal = network_client_->onRequestProposal(event.next_round);
+            }
+            this->prefetchProposals(event.next_round);
             // vote for the object received from the network
-            proposal_notifier_.get_subscriber().on_next(
-                network::OrderingEvent{std::move(proposal),
-                                       event.next_round,
-                                       std::move(event.ledger_state)});
+            proposal_notifier_.get_subscriber().on_next(network::OrderingEvent{
+                this->processProposalRequest(std::move(proposal)),
+                event.next_round,
+                std::move(event.ledger_state)});
           })),
       cache_(std::move(cache)),
       proposal_factory_(std::move(factory)),
@@ -131,6 +139,53 @@ void OnDemandOrderingGate::sendCachedTransactions() {
   }
 }
 
+boost::optional<std::shared_ptr<const OnDemandOrderingService::ProposalType>>
+OnDemandOrderingGate::takePrefetchedProposal(const consensus::Round &round) {
+  std::lock_guard<std::mutex> lock(prefetched_proposals_->mutex);
+  auto &proposals = prefetched_proposals_->proposals;
+  boost::optional<std::shared_ptr<const OnDemandOrderingService::ProposalType>>
+      result;
+  auto it = proposals.find(round);
+  if (it != proposals.end()) {
+    log_->debug("Using prefetched proposal for {}", round);
+    result = it->second;
+  }
+  // proposals of the other rounds were prefetched for the previous round and
+  // may be outdated, e.g. the next commit round is packed again on reject
+  prefetched_proposals_->current_round = round;
+  proposals.clear();
+  return result;
+}
+
+void OnDemandOrderingGate::prefetchProposals(const consensus::Round &round) {
+  // a proposal for a reject round is packed once. The proposal for the next
+  // commit round is packed again on every reject round, so it is prefetched
+  // only in the first round of a block, before it can be changed
+  std::vector<consensus::Round> next_rounds{nextRejectRound(round)};
+  if (round.reject_round == kFirstRejectRound) {
+    next_rounds.push_back(nextCommitRound(round));
+  }
+  for (const auto &next_round : next_rounds) {
+    network_client_->onPrefetchProposal(
+        next_round,
+        [prefetched_proposals =
+             std::weak_ptr<PrefetchedProposals>(prefetched_proposals_),
+         round,
+         next_round](auto proposal) {
+          auto prefetched = prefetched_proposals.lock();
+          if (not prefetched or not proposal) {
+            return;
+          }
+          std::lock_guard<std::mutex> lock(prefetched->mutex);
+          // a reply which arrives after the round has switched is outdated
+          if (prefetched->current_round != round) {
+            return;
+          }
+          prefetched->proposals[next_round] = *std::move(proposal);
+        });
+  }
+}
+
 std::shared_ptr<const shared_model::interface::Proposal>
 OnDemandOrderingGate::removeReplaysAndDuplicates(
     std::shared_ptr<const shared_model::interface::Proposal> proposal) const {
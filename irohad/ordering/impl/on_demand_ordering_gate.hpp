@@ -8,6 +8,8 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <map>
+#include <mutex>
 #include <shared_mutex>
 
 #include <boost/variant.hpp>
@@ -80,6 +82,20 @@ namespace iroha {
 
       void sendCachedTransactions();
 
+      /**
+       * Take proposal prefetched for the round and drop the ones prefetched
+       * for other rounds
+       */
+      boost::optional<
+          std::shared_ptr<const OnDemandOrderingService::ProposalType>>
+      takePrefetchedProposal(const consensus::Round &round);
+
+      /**
+       * Request proposals for the rounds which may follow the given one and
+       * whose proposals cannot be packed again
+       */
+      void prefetchProposals(const consensus::Round &round);
+
       /**
        * remove already processed transactions from proposal
        */
@@ -94,6 +110,18 @@ namespace iroha {
       size_t transaction_limit_;
       std::shared_ptr<OnDemandOrderingService> ordering_service_;
       std::shared_ptr<transport::OdOsNotification> network_client_;
+
+      /// proposals received ahead of their rounds
+      struct PrefetchedProposals {
+        std::mutex mutex;
+        /// round the proposals are prefetched in, later replies are dropped
+        consensus::Round current_round{0, 0};
+        std::map<consensus::Round,
+                 std::shared_ptr<const OnDemandOrderingService::ProposalType>>
+            proposals;
+      };
+      std::shared_ptr<PrefetchedProposals> prefetched_proposals_;
+
       rxcpp::composite_subscription processed_tx_hashes_subscription_;
       rxcpp::composite_subscription round_switch_subscription_;
       std::shared_ptr<cache::OrderingGateCache> cache_;
@@ -12,7 +12,6 @@
 #include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/for_each.hpp>
-#include <boost/range/size.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "ametsuchi/tx_presence_cache_utils.hpp"
 #include "common/visitor.hpp"
@@ -32,13 +31,19 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
         proposal_factory,
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
+    std::shared_ptr<BatchesPackingPolicy> packing_policy,
     logger::LoggerPtr log,
-    size_t number_of_proposals)
+    size_t number_of_proposals,
+    size_t mempool_size_in_proposals,
+    std::chrono::milliseconds batch_lifetime)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
+      pending_batches_(transaction_limit * mempool_size_in_proposals,
+                       batch_lifetime),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
       proposal_creation_strategy_(std::move(proposal_creation_strategy)),
+      packing_policy_(std::move(packing_policy)),
       log_(std::move(log)) {}
 
 // -------------------------| OnDemandOrderingService |-------------------------
@@ -51,6 +56,22 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
   tryErase(round);
 }
 
+void OnDemandOrderingServiceImpl::onTxsCommitted(const HashesSetType &hashes) {
+  std::lock_guard<std::mutex> lock(batches_mutex_);
+  pending_batches_.remove(hashes);
+  log_->debug("onTxsCommitted => {} batches are pending",
+              pending_batches_.batchesCount());
+}
+
+// -------------------------| OdOsTransactionsSource |--------------------------
+
+OnDemandOrderingServiceImpl::TransactionsCollectionType
+OnDemandOrderingServiceImpl::getTransactions(
+    const HashesCollectionType &hashes) {
+  std::lock_guard<std::mutex> lock(batches_mutex_);
+  return pending_batches_.getTransactions(hashes);
+}
+
 // ----------------------------| OdOsNotification |-----------------------------
 
 void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
@@ -60,12 +81,21 @@ void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
                     batch->reducedHash().hex());
         return not this->batchAlreadyProcessed(*batch);
       });
+  auto now = iroha::time::now();
   std::for_each(
       unprocessed_batches.begin(),
       unprocessed_batches.end(),
-      [this](auto &obj) {
-        std::shared_lock<std::shared_timed_mutex> lock(batches_mutex_);
-        pending_batches_.insert(std::move(obj));
+      [this, now](auto &obj) {
+        if (obj->transactions().size() > transaction_limit_) {
+          log_->warn("batch {} does not fit into a proposal",
+                     obj->reducedHash().hex());
+          return;
+        }
+        std::lock_guard<std::mutex> lock(batches_mutex_);
+        if (not pending_batches_.insert(obj, now)) {
+          log_->debug("batch {} is already pending",
+                      obj->reducedHash().hex());
+        }
       });
   log_->info("onBatches => collection size = {}", batches.size());
 }
@@ -94,60 +124,46 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
   return result;
 }
 
-// ---------------------------------| Private |---------------------------------
-
-/**
- * Get transactions from the given batches queue. Does not break batches -
- * continues getting all the transactions from the ongoing batch until the
- * required amount is collected.
- * @param requested_tx_amount - amount of transactions to get
- * @param batch_collection - the collection to get transactions from
- * @param discarded_txs_amount - the amount of discarded txs
- * @return transactions
- */
-static std::vector<std::shared_ptr<shared_model::interface::Transaction>>
-getTransactions(size_t requested_tx_amount,
-                detail::BatchSetType &batch_collection,
-                boost::optional<size_t &> discarded_txs_amount) {
-  std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
-
-  auto it = batch_collection.begin();
-  for (; it != batch_collection.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
-    collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
-  }
-
-  if (discarded_txs_amount) {
-    *discarded_txs_amount = 0;
-    for (; it != batch_collection.end(); ++it) {
-      *discarded_txs_amount += boost::size((*it)->transactions());
+void OnDemandOrderingServiceImpl::onPrefetchProposal(
+    consensus::Round round, ProposalCallbackType callback) {
+  boost::optional<
+      std::shared_ptr<const OnDemandOrderingServiceImpl::ProposalType>>
+      result;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(proposals_mutex_);
+    auto it = proposal_map_.find(round);
+    if (it != proposal_map_.end()) {
+      result = it->second;
     }
   }
-
-  return collection;
+  log_->debug("onPrefetchProposal, {}, {}returning a proposal.",
+              round,
+              result ? "" : "NOT ");
+  callback(std::move(result));
 }
 
+// ---------------------------------| Private |---------------------------------
+
 void OnDemandOrderingServiceImpl::packNextProposals(
     const consensus::Round &round) {
-  if (not pending_batches_.empty()) {
-    size_t discarded_txs_quantity;
-    auto txs = getTransactions(
-        transaction_limit_, pending_batches_, discarded_txs_quantity);
-    log_->debug("Discarded {} transactions", discarded_txs_quantity);
-    auto now = iroha::time::now();
-    // create proposals for the next commit and reject rounds
-    tryCreateProposal({round.block_round, round.reject_round + 1}, txs, now);
-    tryCreateProposal({round.block_round + 1, kFirstRejectRound}, txs, now);
-  }
-
-  if (round.reject_round == kFirstRejectRound) {
-    std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
-    pending_batches_.clear();
+  auto now = iroha::time::now();
+  TransactionsCollectionType txs;
+  {
+    std::lock_guard<std::mutex> lock(batches_mutex_);
+    if (auto expired = pending_batches_.removeExpired(now)) {
+      log_->debug("Removed {} expired batches", expired);
+    }
+    if (pending_batches_.empty()) {
+      return;
+    }
+    txs = pending_batches_.takeTransactions(transaction_limit_,
+                                           *packing_policy_);
+    log_->debug("{} transactions are left pending",
+                pending_batches_.transactionsCount() - txs.size());
   }
+  // create proposals for the next commit and reject rounds
+  tryCreateProposal({round.block_round, round.reject_round + 1}, txs, now);
+  tryCreateProposal({round.block_round + 1, kFirstRejectRound}, txs, now);
 }
 
 void OnDemandOrderingServiceImpl::tryCreateProposal(
@@ -8,15 +8,15 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
+#include <chrono>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
 
-#include <tbb/concurrent_unordered_set.h>
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
-#include "multi_sig_transactions/hash.hpp"
-// TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
-#include "multi_sig_transactions/state/mst_state.hpp"
+#include "ordering/batches_packing_policy.hpp"
+#include "ordering/impl/batches_mempool.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/ordering_service_proposal_creation_strategy.hpp"
 
@@ -26,11 +26,6 @@ namespace iroha {
   }
   namespace ordering {
     namespace detail {
-      using BatchSetType = tbb::concurrent_unordered_set<
-          transport::OdOsNotification::TransactionBatchType,
-          model::PointerBatchHasher,
-          BatchHashEquality>;
-
       using ProposalMapType = std::map<
           consensus::Round,
           std::shared_ptr<const transport::OdOsNotification::ProposalType>>;
@@ -44,10 +39,16 @@ namespace iroha {
        * proposal
        * @param proposal_factory - used to generate proposals
        * @param tx_cache - cache of transactions
+       * @param packing_policy - selects pending batches for proposals
        * @param log to print progress
        * @param number_of_proposals - number of stored proposals, older will be
        * removed. Default value is 3
        * @param creation_strategy - provides a strategy for creating proposals
+       * @param mempool_size_in_proposals - capacity of pending batches storage
+       * in full proposals, the oldest batches are evicted when it is exceeded.
+       * Default value is 10
+       * @param batch_lifetime - time after which a pending batch is removed if
+       * it was not committed. Default value is 10 minutes
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -55,13 +56,23 @@ namespace iroha {
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy,
+          std::shared_ptr<BatchesPackingPolicy> packing_policy,
           logger::LoggerPtr log,
-          size_t number_of_proposals = 3);
+          size_t number_of_proposals = 3,
+          size_t mempool_size_in_proposals = 10,
+          std::chrono::milliseconds batch_lifetime = std::chrono::minutes(10));
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
       void onCollaborationOutcome(consensus::Round round) override;
 
+      void onTxsCommitted(const HashesSetType &hashes) override;
+
+      // ------------------------ | OdOsTransactionsSource | ------------------
+
+      TransactionsCollectionType getTransactions(
+          const HashesCollectionType &hashes) override;
+
       // ----------------------- | OdOsNotification | --------------------------
 
       void onBatches(CollectionType batches) override;
@@ -69,6 +80,9 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      void onPrefetchProposal(consensus::Round round,
+                              ProposalCallbackType callback) override;
+
      private:
       /**
        * Packs new proposals and creates new rounds
@@ -76,9 +90,6 @@ namespace iroha {
        */
       void packNextProposals(const consensus::Round &round);
 
-      using TransactionsCollectionType =
-          std::vector<std::shared_ptr<shared_model::interface::Transaction>>;
-
       void tryCreateProposal(
           consensus::Round round,
           const TransactionsCollectionType &txs,
@@ -113,14 +124,19 @@ namespace iroha {
       detail::ProposalMapType proposal_map_;
 
       /**
-       * Collections of batches for current round
+       * Batches which are not committed yet
        */
-      detail::BatchSetType pending_batches_;
+      BatchesMempool pending_batches_;
 
       /**
-       * Batches and proposal collection mutexes for public methods
+       * Pending batches mutex for public methods
        */
-      std::shared_timed_mutex batches_mutex_, proposals_mutex_;
+      std::mutex batches_mutex_;
+
+      /**
+       * Proposal collection mutex for public methods
+       */
+      std::shared_timed_mutex proposals_mutex_;
 
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
@@ -135,6 +151,11 @@ namespace iroha {
        */
       std::shared_ptr<ProposalCreationStrategy> proposal_creation_strategy_;
 
+      /**
+       * Policy of selecting pending batches for proposals
+       */
+      std::shared_ptr<BatchesPackingPolicy> packing_policy_;
+
       /**
        * Logger instance
        */
@@ -5,6 +5,8 @@
 
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 
+#include <algorithm>
+
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "interfaces/common_objects/peer.hpp"
@@ -16,6 +18,28 @@ using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+namespace {
+  /**
+   * Build proposal from transport representation
+   */
+  boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+  buildProposal(OnDemandOsClientGrpc::TransportFactoryType &proposal_factory,
+                const iroha::protocol::Proposal &proposal,
+                const logger::LoggerPtr &log) {
+    return proposal_factory.build(proposal).match(
+        [&](auto &&v) {
+          return boost::make_optional(
+              std::shared_ptr<const OdOsNotification::ProposalType>(
+                  std::move(v).value));
+        },
+        [&log](const auto &error) {
+          log->info("{}", error.error.error);  // error
+          return boost::optional<
+              std::shared_ptr<const OdOsNotification::ProposalType>>();
+        });
+  }
+}  // namespace
+
 OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
@@ -23,13 +47,17 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<TimepointType()> time_provider,
     std::chrono::milliseconds proposal_request_timeout,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<OdOsTransactionsSource> transactions_source,
+    std::shared_ptr<ProposalAsyncCallType> proposal_async_call)
     : log_(std::move(log)),
       stub_(std::move(stub)),
       async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
-      proposal_request_timeout_(proposal_request_timeout) {}
+      proposal_request_timeout_(proposal_request_timeout),
+      transactions_source_(std::move(transactions_source)),
+      proposal_async_call_(std::move(proposal_async_call)) {}
 
 void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
   proto::BatchesRequest request;
@@ -50,32 +78,156 @@ void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
 
 boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
 OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
+  // all requests required to get the proposal share the same deadline
+  auto deadline = time_provider_() + proposal_request_timeout_;
   grpc::ClientContext context;
-  context.set_deadline(time_provider_() + proposal_request_timeout_);
+  context.set_deadline(deadline);
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_compact(transactions_source_ != nullptr);
   proto::ProposalResponse response;
   auto status = stub_->RequestProposal(&context, request, &response);
   if (not status.ok()) {
     log_->warn("RPC failed: {}", status.error_message());
     return boost::none;
   }
+  if (response.has_compact_proposal() and transactions_source_) {
+    return rebuildProposal(round, response.compact_proposal(), deadline);
+  }
   if (not response.has_proposal()) {
     return boost::none;
   }
-  return proposal_factory_->build(response.proposal())
-      .match(
-          [&](auto &&v) {
-            return boost::make_optional(
-                std::shared_ptr<const OdOsNotification::ProposalType>(
-                    std::move(v).value));
-          },
-          [this](const auto &error) {
-            log_->info("{}", error.error.error);  // error
-            return boost::optional<
-                std::shared_ptr<const OdOsNotification::ProposalType>>();
-          });
+  return buildProposal(*proposal_factory_, response.proposal(), log_);
+}
+
+void OnDemandOsClientGrpc::onPrefetchProposal(consensus::Round round,
+                                              ProposalCallbackType callback) {
+  if (not proposal_async_call_) {
+    callback(boost::none);
+    return;
+  }
+  auto deadline = time_provider_() + proposal_request_timeout_;
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_prefetch(true);
+  proposal_async_call_->Call(
+      [&](auto context, auto cq) {
+        context->set_deadline(deadline);
+        return stub_->AsyncRequestProposal(context, request, cq);
+      },
+      [proposal_factory = proposal_factory_,
+       log = log_,
+       callback = std::move(callback)](
+          const grpc::Status &status,
+          const proto::ProposalResponse &response) {
+        if (not status.ok() or not response.has_proposal()) {
+          callback(boost::none);
+          return;
+        }
+        callback(buildProposal(*proposal_factory, response.proposal(), log));
+      });
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientGrpc::rebuildProposal(const consensus::Round &round,
+                                      const proto::CompactProposal &compact,
+                                      TimepointType deadline) {
+  OdOsTransactionsSource::HashesCollectionType hashes;
+  for (const auto &hash : compact.transaction_hashes()) {
+    hashes.emplace_back(hash);
+  }
+
+  TransportTransactionsType transactions;
+  auto local_transactions = transactions_source_->getTransactions(hashes);
+  for (const auto &transaction : local_transactions) {
+    transactions.emplace(
+        transaction->hash(),
+        static_cast<const shared_model::proto::Transaction *>(
+            transaction.get())
+            ->getTransport());
+  }
+
+  OdOsTransactionsSource::HashesCollectionType missing;
+  std::copy_if(hashes.begin(),
+               hashes.end(),
+               std::back_inserter(missing),
+               [&transactions](const auto &hash) {
+                 return transactions.count(hash) == 0;
+               });
+  log_->debug("Rebuilding proposal for {}: {} local, {} missing transactions",
+              round,
+              hashes.size() - missing.size(),
+              missing.size());
+  if (not missing.empty()
+      and not requestTransactions(round, missing, deadline, transactions)) {
+    return boost::none;
+  }
+
+  auto assemble = [&] {
+    iroha::protocol::Proposal proposal;
+    proposal.set_height(compact.height());
+    proposal.set_created_time(compact.created_time());
+    for (const auto &hash : hashes) {
+      *proposal.add_transactions() = transactions.at(hash);
+    }
+    return buildProposal(*proposal_factory_, proposal, log_);
+  };
+  auto matches = [&compact](const auto &proposal) {
+    return proposal
+        and shared_model::crypto::toBinaryString((*proposal)->hash())
+        == compact.proposal_hash();
+  };
+
+  auto proposal = assemble();
+  if (matches(proposal)) {
+    return proposal;
+  }
+
+  // local copies of transactions may differ from the ones of the peer, for
+  // example by the set of signatures, so all of them are requested
+  log_->info("Rebuilt proposal for {} does not match, requesting all", round);
+  transactions.clear();
+  if (not requestTransactions(round, hashes, deadline, transactions)) {
+    return boost::none;
+  }
+  proposal = assemble();
+  if (matches(proposal)) {
+    return proposal;
+  }
+  log_->warn("Proposal for {} received from the peer does not match its hash",
+             round);
+  return boost::none;
+}
+
+bool OnDemandOsClientGrpc::requestTransactions(
+    const consensus::Round &round,
+    const OdOsTransactionsSource::HashesCollectionType &hashes,
+    TimepointType deadline,
+    TransportTransactionsType &transactions) {
+  grpc::ClientContext context;
+  context.set_deadline(deadline);
+  proto::TransactionsRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  for (const auto &hash : hashes) {
+    request.add_hashes(shared_model::crypto::toBinaryString(hash));
+  }
+  proto::TransactionsResponse response;
+  auto status = stub_->RequestTransactions(&context, request, &response);
+  if (not status.ok()) {
+    log_->warn("RPC failed: {}", status.error_message());
+    return false;
+  }
+  if (static_cast<size_t>(response.transactions_size()) != hashes.size()) {
+    log_->warn("Peer does not have transactions of proposal for {}", round);
+    return false;
+  }
+  for (size_t i = 0; i < hashes.size(); ++i) {
+    transactions[hashes[i]] = response.transactions(i);
+  }
+  return true;
 }
 
 OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
@@ -84,12 +236,17 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
     OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-    logger::LoggerPtr client_log)
+    logger::LoggerPtr client_log,
+    std::shared_ptr<OdOsTransactionsSource> transactions_source,
+    std::shared_ptr<OnDemandOsClientGrpc::ProposalAsyncCallType>
+        proposal_async_call)
     : async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
       proposal_request_timeout_(proposal_request_timeout),
-      client_log_(std::move(client_log)) {}
+      client_log_(std::move(client_log)),
+      transactions_source_(std::move(transactions_source)),
+      proposal_async_call_(std::move(proposal_async_call)) {}
 
 std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
     const shared_model::interface::Peer &to) {
@@ -99,5 +256,7 @@ std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
       proposal_factory_,
       time_provider_,
       proposal_request_timeout_,
-      client_log_);
+      client_log_,
+      transactions_source_,
+      proposal_async_call_);
 }
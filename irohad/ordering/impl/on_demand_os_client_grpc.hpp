@@ -8,6 +8,8 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <unordered_map>
+
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
@@ -28,10 +30,16 @@ namespace iroha {
                 iroha::protocol::Proposal>;
         using TimepointType = std::chrono::system_clock::time_point;
         using TimeoutType = std::chrono::milliseconds;
+        using ProposalAsyncCallType =
+            network::AsyncGrpcClient<proto::ProposalResponse>;
 
         /**
          * Constructor is left public because testing required passing a mock
          * stub interface
+         * @param transactions_source - source of local transactions, proposals
+         * are requested in compact form when it is present
+         * @param proposal_async_call - client for prefetch requests, proposals
+         * are not prefetched when it is absent
          */
         OnDemandOsClientGrpc(
             std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
@@ -40,14 +48,50 @@ namespace iroha {
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<TimepointType()> time_provider,
             std::chrono::milliseconds proposal_request_timeout,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<OdOsTransactionsSource> transactions_source =
+                nullptr,
+            std::shared_ptr<ProposalAsyncCallType> proposal_async_call =
+                nullptr);
 
         void onBatches(CollectionType batches) override;
 
         boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
             consensus::Round round) override;
 
+        /**
+         * Prefetched proposals are always requested in full form, since the
+         * client may be destroyed before the response is received
+         */
+        void onPrefetchProposal(consensus::Round round,
+                                ProposalCallbackType callback) override;
+
        private:
+        using TransportTransactionsType =
+            std::unordered_map<shared_model::crypto::Hash,
+                               iroha::protocol::Transaction,
+                               shared_model::crypto::Hash::Hasher>;
+
+        /**
+         * Rebuild proposal from compact representation using local
+         * transactions, missing ones are requested from the peer
+         */
+        boost::optional<std::shared_ptr<const ProposalType>> rebuildProposal(
+            const consensus::Round &round,
+            const proto::CompactProposal &compact,
+            TimepointType deadline);
+
+        /**
+         * Request transactions of compact proposal from the peer
+         * @param transactions - map where received transactions are stored
+         * @return true if all requested transactions are received
+         */
+        bool requestTransactions(
+            const consensus::Round &round,
+            const OdOsTransactionsSource::HashesCollectionType &hashes,
+            TimepointType deadline,
+            TransportTransactionsType &transactions);
+
         logger::LoggerPtr log_;
         std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
@@ -55,6 +99,8 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
+        std::shared_ptr<OdOsTransactionsSource> transactions_source_;
+        std::shared_ptr<ProposalAsyncCallType> proposal_async_call_;
       };
 
       class OnDemandOsClientGrpcFactory : public OdOsNotificationFactory {
@@ -66,7 +112,11 @@ namespace iroha {
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
             OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-            logger::LoggerPtr client_log);
+            logger::LoggerPtr client_log,
+            std::shared_ptr<OdOsTransactionsSource> transactions_source =
+                nullptr,
+            std::shared_ptr<OnDemandOsClientGrpc::ProposalAsyncCallType>
+                proposal_async_call = nullptr);
 
         /**
          * Create connection with insecure gRPC channel defined by
@@ -84,6 +134,9 @@ namespace iroha {
         std::function<OnDemandOsClientGrpc::TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
         logger::LoggerPtr client_log_;
+        std::shared_ptr<OdOsTransactionsSource> transactions_source_;
+        std::shared_ptr<OnDemandOsClientGrpc::ProposalAsyncCallType>
+            proposal_async_call_;
       };
 
     }  // namespace transport
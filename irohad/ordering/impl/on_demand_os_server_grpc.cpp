@@ -7,9 +7,11 @@
 
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <future>
+#include <unordered_map>
+
 #include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
@@ -20,6 +22,8 @@ using namespace iroha::ordering::transport;
 OnDemandOsServerGrpc::OnDemandOsServerGrpc(
     std::shared_ptr<OdOsNotification> ordering_service,
     std::shared_ptr<TransportFactoryType> transaction_factory,
+    std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+        transaction_builder,
     std::shared_ptr<shared_model::interface::TransactionBatchParser>
         batch_parser,
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -27,6 +31,7 @@ OnDemandOsServerGrpc::OnDemandOsServerGrpc(
     logger::LoggerPtr log)
     : ordering_service_(ordering_service),
       transaction_factory_(std::move(transaction_factory)),
+      transaction_builder_(std::move(transaction_builder)),
       batch_parser_(std::move(batch_parser)),
       batch_factory_(std::move(transaction_batch_factory)),
       log_(std::move(log)) {}
@@ -34,27 +39,20 @@ OnDemandOsServerGrpc::OnDemandOsServerGrpc(
 shared_model::interface::types::SharedTxsCollectionType
 OnDemandOsServerGrpc::deserializeTransactions(
     const proto::BatchesRequest *request) {
-  return boost::copy_range<
-      shared_model::interface::types::SharedTxsCollectionType>(
-      request->transactions()
-      | boost::adaptors::transformed(
-            [&](const auto &tx) { return transaction_factory_->build(tx); })
-      | boost::adaptors::filtered([&](const auto &result) {
-          return result.match(
-              [](const auto &) { return true; },
-              [&](const auto &error) {
-                log_->info("Transaction deserialization failed: hash {}, {}",
-                           error.error.hash,
-                           error.error.error);
-                return false;
-              });
-        })
-      | boost::adaptors::transformed([](auto result) {
-          return std::move(
-                     boost::get<iroha::expected::ValueOf<decltype(result)>>(
-                         result))
-              .value;
-        }));
+  shared_model::interface::types::SharedTxsCollectionType tx_collection;
+  for (auto &result : transaction_builder_->build(*transaction_factory_,
+                                                  request->transactions())) {
+    std::move(result).match(
+        [&tx_collection](auto &&v) {
+          tx_collection.emplace_back(std::move(v).value);
+        },
+        [this](const auto &error) {
+          log_->info("Transaction deserialization failed: hash {}, {}",
+                     error.error.hash,
+                     error.error.error);
+        });
+  }
+  return tx_collection;
 }
 
 grpc::Status OnDemandOsServerGrpc::SendBatches(
@@ -87,12 +85,90 @@ grpc::Status OnDemandOsServerGrpc::RequestProposal(
     ::grpc::ServerContext *context,
     const proto::ProposalRequest *request,
     proto::ProposalResponse *response) {
-  ordering_service_->onRequestProposal(
-      {request->round().block_round(), request->round().reject_round()})
-      | [&](auto &&proposal) {
-          *response->mutable_proposal() =
-              static_cast<const shared_model::proto::Proposal *>(proposal.get())
-                  ->getTransport();
-        };
+  consensus::Round round{request->round().block_round(),
+                         request->round().reject_round()};
+  auto requested_proposal = request->prefetch()
+      ? prefetchProposal(round)
+      : ordering_service_->onRequestProposal(round);
+  std::move(requested_proposal) | [&](auto &&proposal) {
+    if (not request->compact()) {
+      *response->mutable_proposal() =
+          static_cast<const shared_model::proto::Proposal *>(proposal.get())
+              ->getTransport();
+      return;
+    }
+    auto compact = response->mutable_compact_proposal();
+    compact->set_height(proposal->height());
+    compact->set_created_time(proposal->createdTime());
+    for (const auto &transaction : proposal->transactions()) {
+      compact->add_transaction_hashes(
+          shared_model::crypto::toBinaryString(transaction.hash()));
+    }
+    compact->set_proposal_hash(
+        shared_model::crypto::toBinaryString(proposal->hash()));
+    this->rememberServedProposal(round, std::move(proposal));
+  };
   return ::grpc::Status::OK;
 }
+
+grpc::Status OnDemandOsServerGrpc::RequestTransactions(
+    ::grpc::ServerContext *context,
+    const proto::TransactionsRequest *request,
+    proto::TransactionsResponse *response) {
+  consensus::Round round{request->round().block_round(),
+                         request->round().reject_round()};
+  std::shared_ptr<const OdOsNotification::ProposalType> proposal;
+  {
+    std::lock_guard<std::mutex> lock(served_proposals_mutex_);
+    auto it = served_proposals_.find(round);
+    if (it == served_proposals_.end()) {
+      log_->warn("Transactions requested for unknown proposal of round {}",
+                 round);
+      return ::grpc::Status::OK;
+    }
+    proposal = it->second;
+  }
+
+  std::unordered_map<std::string, const shared_model::proto::Transaction *>
+      transactions;
+  for (const auto &transaction : proposal->transactions()) {
+    transactions.emplace(
+        shared_model::crypto::toBinaryString(transaction.hash()),
+        static_cast<const shared_model::proto::Transaction *>(&transaction));
+  }
+
+  for (const auto &hash : request->hashes()) {
+    auto it = transactions.find(hash);
+    if (it == transactions.end()) {
+      log_->warn("Requested transaction is not in proposal of round {}",
+                 round);
+      response->clear_transactions();
+      return ::grpc::Status::OK;
+    }
+    *response->add_transactions() = it->second->getTransport();
+  }
+  return ::grpc::Status::OK;
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsServerGrpc::prefetchProposal(const consensus::Round &round) {
+  using ResultType =
+      boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>;
+  // the callback may be called from another thread after returning
+  auto result = std::make_shared<std::promise<ResultType>>();
+  auto future = result->get_future();
+  ordering_service_->onPrefetchProposal(round, [result](auto proposal) {
+    result->set_value(std::move(proposal));
+  });
+  return future.get();
+}
+
+void OnDemandOsServerGrpc::rememberServedProposal(
+    const consensus::Round &round,
+    std::shared_ptr<const OdOsNotification::ProposalType> proposal) {
+  std::lock_guard<std::mutex> lock(served_proposals_mutex_);
+  served_proposals_[round] = std::move(proposal);
+  while (served_proposals_.size() > kMaxServedProposals) {
+    served_proposals_.erase(served_proposals_.begin());
+  }
+}
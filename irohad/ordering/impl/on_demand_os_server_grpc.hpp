@@ -8,7 +8,11 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <map>
+#include <mutex>
+
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "logger/logger_fwd.hpp"
@@ -31,6 +35,8 @@ namespace iroha {
         OnDemandOsServerGrpc(
             std::shared_ptr<OdOsNotification> ordering_service,
             std::shared_ptr<TransportFactoryType> transaction_factory,
+            std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+                transaction_builder,
             std::shared_ptr<shared_model::interface::TransactionBatchParser>
                 batch_parser,
             std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -46,7 +52,27 @@ namespace iroha {
             const proto::ProposalRequest *request,
             proto::ProposalResponse *response) override;
 
+        grpc::Status RequestTransactions(
+            ::grpc::ServerContext *context,
+            const proto::TransactionsRequest *request,
+            proto::TransactionsResponse *response) override;
+
        private:
+        /**
+         * Get proposal requested ahead of the round from the ordering
+         * service, waiting until it is available
+         */
+        boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+        prefetchProposal(const consensus::Round &round);
+
+        /**
+         * Remember proposal sent in compact form, so its transactions can be
+         * requested later
+         */
+        void rememberServedProposal(
+            const consensus::Round &round,
+            std::shared_ptr<const OdOsNotification::ProposalType> proposal);
+
         /**
          * Flat map transport transactions to shared model
          */
@@ -56,11 +82,21 @@ namespace iroha {
         std::shared_ptr<OdOsNotification> ordering_service_;
 
         std::shared_ptr<TransportFactoryType> transaction_factory_;
+        std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+            transaction_builder_;
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser_;
         std::shared_ptr<shared_model::interface::TransactionBatchFactory>
             batch_factory_;
 
+        /// number of the latest rounds which served proposals are kept for
+        static constexpr size_t kMaxServedProposals = 4;
+
+        std::mutex served_proposals_mutex_;
+        std::map<consensus::Round,
+                 std::shared_ptr<const OdOsNotification::ProposalType>>
+            served_proposals_;
+
         logger::LoggerPtr log_;
       };
 
@@ -8,19 +8,35 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <unordered_set>
+
+#include "cryptography/hash.hpp"
+
 namespace iroha {
   namespace ordering {
 
     /**
      * Ordering Service aka OS which can share proposals by request
      */
-    class OnDemandOrderingService : public transport::OdOsNotification {
+    class OnDemandOrderingService : public transport::OdOsNotification,
+                                    public transport::OdOsTransactionsSource {
      public:
+      using HashesSetType =
+          std::unordered_set<shared_model::crypto::Hash,
+                             shared_model::crypto::Hash::Hasher>;
+
       /**
        * Method which should be invoked on outcome of collaboration for round
        * @param round - proposal round which has started
        */
       virtual void onCollaborationOutcome(consensus::Round round) = 0;
+
+      /**
+       * Method which should be invoked when a block is committed
+       * @param hashes - hashes of transactions which were committed or
+       * rejected in the block
+       */
+      virtual void onTxsCommitted(const HashesSetType &hashes) = 0;
     };
 
   }  // namespace ordering
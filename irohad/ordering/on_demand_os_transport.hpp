@@ -6,15 +6,18 @@
 #ifndef IROHA_ON_DEMAND_OS_TRANSPORT_HPP
 #define IROHA_ON_DEMAND_OS_TRANSPORT_HPP
 
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include <boost/optional.hpp>
 #include "consensus/round.hpp"
+#include "cryptography/hash.hpp"
 
 namespace shared_model {
   namespace interface {
+    class Transaction;
     class TransactionBatch;
     class Proposal;
     class Peer;
@@ -61,9 +64,47 @@ namespace iroha {
         virtual boost::optional<std::shared_ptr<const ProposalType>>
         onRequestProposal(consensus::Round round) = 0;
 
+        /**
+         * Type of callback which receives prefetched proposal
+         */
+        using ProposalCallbackType = std::function<void(
+            boost::optional<std::shared_ptr<const ProposalType>>)>;
+
+        /**
+         * Request proposal ahead of the round without waiting for it.
+         * Unlike onRequestProposal, the request is not taken into account by
+         * proposal creation strategy
+         * @param round - round of the requested proposal
+         * @param callback - called with the result when it is available,
+         * possibly from another thread
+         */
+        virtual void onPrefetchProposal(consensus::Round round,
+                                        ProposalCallbackType callback) = 0;
+
         virtual ~OdOsNotification() = default;
       };
 
+      /**
+       * Source of locally known transactions, which is used to rebuild
+       * proposals received in compact form
+       */
+      class OdOsTransactionsSource {
+       public:
+        using TransactionsCollectionType =
+            std::vector<std::shared_ptr<shared_model::interface::Transaction>>;
+        using HashesCollectionType = std::vector<shared_model::crypto::Hash>;
+
+        /**
+         * Get transactions by their hashes
+         * @param hashes - hashes of required transactions
+         * @return found transactions in no particular order
+         */
+        virtual TransactionsCollectionType getTransactions(
+            const HashesCollectionType &hashes) = 0;
+
+        virtual ~OdOsTransactionsSource() = default;
+      };
+
       /**
        * Factory for creating communication interface to a specific peer
        */
@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_PACKING_POLICY_TYPE_HPP
+#define IROHA_ORDERING_PACKING_POLICY_TYPE_HPP
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Kinds of available packing policies
+     */
+    enum class PackingPolicyType {
+      /// batches in order of arrival
+      kFifo,
+      /// batches of different creators in turn
+      kRoundRobin,
+      /// the oldest batch and the best fill of proposal by the rest
+      kKnapsack
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_PACKING_POLICY_TYPE_HPP
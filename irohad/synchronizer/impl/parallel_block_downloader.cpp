@@ -0,0 +1,209 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/parallel_block_downloader.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "logger/logger.hpp"
+
+using namespace iroha::synchronizer;
+using shared_model::interface::types::HeightType;
+
+namespace {
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+
+  /// Progress of a single download shared by its threads
+  struct DownloadState {
+    std::mutex mutex;
+    std::condition_variable changed;
+    /// windows which are not retrieved and not being retrieved
+    std::set<size_t> pending;
+    /// retrieved windows which are not emitted yet
+    std::map<size_t, std::vector<BlockPtr>> retrieved;
+    /// number of windows being retrieved
+    size_t in_flight = 0;
+    /// index of the next window to emit
+    size_t next_emitted = 0;
+    /// index of the next peer which has not been asked yet
+    size_t next_peer = 0;
+    /// number of workers which have not run out of peers
+    size_t active_workers = 0;
+    bool stopped = false;
+  };
+
+  /// Stops and joins the workers of a download when it is left, including by
+  /// an exception thrown by its subscriber
+  class WorkersGuard {
+   public:
+    WorkersGuard(DownloadState &state, std::vector<std::thread> &threads)
+        : state_(state), threads_(threads) {}
+
+    ~WorkersGuard() {
+      stop();
+    }
+
+    /// Stop the workers and wait for them to finish
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(state_.mutex);
+        state_.stopped = true;
+      }
+      state_.changed.notify_all();
+      for (auto &thread : threads_) {
+        if (thread.joinable()) {
+          thread.join();
+        }
+      }
+    }
+
+   private:
+    DownloadState &state_;
+    std::vector<std::thread> &threads_;
+  };
+}  // namespace
+
+ParallelBlockDownloader::ParallelBlockDownloader(
+    std::shared_ptr<network::BlockLoader> block_loader,
+    logger::LoggerPtr log,
+    HeightType window_size,
+    size_t windows_ahead)
+    : block_loader_(std::move(block_loader)),
+      log_(std::move(log)),
+      window_size_(std::max<HeightType>(window_size, 1)),
+      windows_ahead_(std::max<size_t>(windows_ahead, 1)) {}
+
+rxcpp::observable<BlockPtr> ParallelBlockDownloader::download(
+    HeightType first_height,
+    HeightType last_height,
+    std::vector<shared_model::interface::types::PubkeyType> peers) const {
+  return rxcpp::observable<>::create<BlockPtr>(
+      [this, first_height, last_height, peers = std::move(peers)](
+          rxcpp::subscriber<BlockPtr> subscriber) {
+        this->downloadTo(first_height, last_height, peers, subscriber);
+      });
+}
+
+void ParallelBlockDownloader::downloadTo(
+    HeightType first_height,
+    HeightType last_height,
+    const std::vector<shared_model::interface::types::PubkeyType> &peers,
+    rxcpp::subscriber<BlockPtr> &subscriber) const {
+  if (last_height < first_height or peers.empty()) {
+    subscriber.on_completed();
+    return;
+  }
+  const size_t windows = (last_height - first_height) / window_size_ + 1;
+  auto window_first = [&](size_t window) {
+    return first_height + window * window_size_;
+  };
+  auto window_last = [&](size_t window) {
+    return std::min(last_height, window_first(window) + window_size_ - 1);
+  };
+
+  DownloadState state;
+  for (size_t i = 0; i < windows; ++i) {
+    state.pending.insert(i);
+  }
+  const auto workers = std::min(peers.size(), windows);
+  state.next_peer = workers;
+  state.active_workers = workers;
+
+  auto work = [&](size_t peer_index) {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    while (true) {
+      state.changed.wait(lock, [&] {
+        return state.stopped
+            or (state.pending.empty() and state.in_flight == 0)
+            or (not state.pending.empty()
+                and *state.pending.begin()
+                    < state.next_emitted + windows_ahead_);
+      });
+      if (state.stopped or state.pending.empty()) {
+        return;
+      }
+      auto window = *state.pending.begin();
+      state.pending.erase(state.pending.begin());
+      ++state.in_flight;
+
+      lock.unlock();
+      auto blocks = block_loader_->retrieveBlockRange(
+          peers[peer_index], window_first(window), window_last(window));
+      lock.lock();
+
+      --state.in_flight;
+      if (blocks) {
+        state.retrieved.emplace(window, std::move(*blocks));
+        state.changed.notify_all();
+        continue;
+      }
+      log_->warn("Failed to retrieve blocks {} to {} from peer {}",
+                 window_first(window),
+                 window_last(window),
+                 peers[peer_index].hex());
+      state.pending.insert(window);
+      state.changed.notify_all();
+      // the failed peer is replaced with one which has not been asked yet
+      if (state.next_peer < peers.size()) {
+        peer_index = state.next_peer++;
+        continue;
+      }
+      if (--state.active_workers == 0) {
+        state.stopped = true;
+        state.changed.notify_all();
+      }
+      return;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  WorkersGuard guard(state, threads);
+  for (size_t i = 0; i < workers; ++i) {
+    threads.emplace_back(work, i);
+  }
+
+  for (size_t window = 0; window < windows; ++window) {
+    std::vector<BlockPtr> blocks;
+    {
+      std::unique_lock<std::mutex> lock(state.mutex);
+      state.changed.wait(lock, [&] {
+        return state.stopped or state.retrieved.count(window) != 0;
+      });
+      auto it = state.retrieved.find(window);
+      if (it == state.retrieved.end()) {
+        log_->error("No peer provided blocks {} to {}",
+                    window_first(window),
+                    window_last(window));
+        break;
+      }
+      blocks = std::move(it->second);
+      state.retrieved.erase(it);
+      state.next_emitted = window + 1;
+    }
+    state.changed.notify_all();
+
+    for (auto &block : blocks) {
+      if (not subscriber.is_subscribed()) {
+        break;
+      }
+      subscriber.on_next(std::move(block));
+    }
+    if (not subscriber.is_subscribed()) {
+      break;
+    }
+  }
+
+  guard.stop();
+  subscriber.on_completed();
+}
+
+HeightType ParallelBlockDownloader::windowSize() const {
+  return window_size_;
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
+#define IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
+
+#include <memory>
+#include <vector>
+
+#include <rxcpp/rx-lite.hpp>
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "network/block_loader.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    /**
+     * Downloads a long range of blocks from several peers at once. The range
+     * is split into windows, and each peer retrieves one window at a time.
+     * Windows are emitted in height order, so the result is a contiguous
+     * chain. A window which a peer failed to provide is retried by another
+     * peer, while the failed peer is not asked any more and is replaced with
+     * a peer which has not been asked yet, if any.
+     */
+    class ParallelBlockDownloader {
+     public:
+      /// Default number of blocks in a window
+      static const shared_model::interface::types::HeightType
+          kDefaultWindowSize = 500;
+
+      /// Default number of windows downloaded ahead of the emitted one
+      static const size_t kDefaultWindowsAhead = 8;
+
+      /**
+       * @param block_loader - loader of block ranges from single peers
+       * @param log - logger
+       * @param window_size - number of blocks requested from a peer at once
+       * @param windows_ahead - maximal number of windows held in memory
+       */
+      ParallelBlockDownloader(
+          std::shared_ptr<network::BlockLoader> block_loader,
+          logger::LoggerPtr log,
+          shared_model::interface::types::HeightType window_size =
+              kDefaultWindowSize,
+          size_t windows_ahead = kDefaultWindowsAhead);
+
+      /**
+       * Download blocks, the download starts on subscription and the
+       * subscriber is called on the subscribing thread
+       * @param first_height - height of the first block
+       * @param last_height - height of the last block
+       * @param peers - public keys of peers to download from
+       * @return blocks in height order. Completes early if some window could
+       * not be retrieved from any peer
+       */
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      download(shared_model::interface::types::HeightType first_height,
+               shared_model::interface::types::HeightType last_height,
+               std::vector<shared_model::interface::types::PubkeyType> peers)
+          const;
+
+      /// @return number of blocks in a window
+      shared_model::interface::types::HeightType windowSize() const;
+
+     private:
+      /// Run the download of the observable returned by download()
+      void downloadTo(
+          shared_model::interface::types::HeightType first_height,
+          shared_model::interface::types::HeightType last_height,
+          const std::vector<shared_model::interface::types::PubkeyType> &peers,
+          rxcpp::subscriber<std::shared_ptr<shared_model::interface::Block>>
+              &subscriber) const;
+
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      logger::LoggerPtr log_;
+      const shared_model::interface::types::HeightType window_size_;
+      const size_t windows_ahead_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_PARALLEL_BLOCK_DOWNLOADER_HPP
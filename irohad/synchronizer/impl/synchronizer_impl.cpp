@@ -32,6 +32,7 @@ namespace iroha {
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          block_downloader_(block_loader_, log),
           notifier_(notifier_lifetime_),
           log_(std::move(log)) {
       consensus_gate->onOutcome().subscribe(
@@ -83,17 +84,66 @@ namespace iroha {
                      });
     }
 
+    ametsuchi::CommitResult SynchronizerImpl::downloadAndCommitInParallel(
+        const shared_model::interface::types::HeightType start_height,
+        const shared_model::interface::types::HeightType target_height,
+        const PublicKeysRange &public_keys) {
+      auto storage = getStorage();
+
+      shared_model::interface::types::HeightType my_height = start_height;
+      auto network_chain =
+          block_downloader_
+              .download(start_height + 1,
+                        target_height,
+                        {public_keys.begin(), public_keys.end()})
+              .tap([&my_height](
+                       const std::shared_ptr<shared_model::interface::Block>
+                           &block) { my_height = block->height(); });
+
+      // blocks applied before the download stopped are committed as well, so
+      // that they are not downloaded again
+      if (validator_->validateAndApply(network_chain, *storage)
+          and my_height > start_height) {
+        return mutable_factory_->commit(std::move(storage));
+      }
+      return expected::makeError("Failed to download blocks in parallel");
+    }
+
     ametsuchi::CommitResult SynchronizerImpl::downloadAndCommitMissingBlocks(
         const shared_model::interface::types::HeightType start_height,
         const shared_model::interface::types::HeightType target_height,
         const PublicKeysRange &public_keys) {
+      auto committed_height = start_height;
+      ametsuchi::CommitResult parallel_result =
+          expected::makeError("Blocks were not downloaded in parallel");
+      // a gap of several windows is split between the peers
+      if (target_height > start_height + block_downloader_.windowSize()) {
+        parallel_result = downloadAndCommitInParallel(
+            start_height, target_height, public_keys);
+        if (auto ledger_state =
+                expected::resultToOptionalValue(parallel_result)) {
+          committed_height = (*ledger_state)->top_block_info.height;
+          if (committed_height >= target_height) {
+            return parallel_result;
+          }
+          log_->warn(
+              "Downloaded blocks up to {} in parallel, loading the rest from "
+              "single peers",
+              committed_height);
+        } else {
+          log_->warn("{}, loading blocks from single peers",
+                     expected::resultToOptionalError(parallel_result).value());
+        }
+      }
+
       // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
       for (const auto &public_key : public_keys) {
         auto storage = getStorage();
 
-        shared_model::interface::types::HeightType my_height = start_height;
+        shared_model::interface::types::HeightType my_height =
+            committed_height;
         auto network_chain =
-            block_loader_->retrieveBlocks(start_height, public_key)
+            block_loader_->retrieveBlocks(committed_height, public_key)
                 .tap([&my_height](
                          const std::shared_ptr<shared_model::interface::Block>
                              &block) { my_height = block->height(); });
@@ -103,6 +153,10 @@ namespace iroha {
           return mutable_factory_->commit(std::move(storage));
         }
       }
+      if (expected::hasValue(parallel_result)) {
+        // report blocks which were committed, even if not all of them
+        return parallel_result;
+      }
       return expected::makeError(
           "Failed to download and commit blocks from given peers");
     }
@@ -15,6 +15,7 @@
 #include "logger/logger_fwd.hpp"
 #include "network/block_loader.hpp"
 #include "network/consensus_gate.hpp"
+#include "synchronizer/impl/parallel_block_downloader.hpp"
 #include "validation/chain_validator.hpp"
 
 namespace iroha {
@@ -47,6 +48,19 @@ namespace iroha {
           boost::any_range<shared_model::interface::types::PubkeyType,
                            boost::forward_traversal_tag,
                            const shared_model::interface::types::PubkeyType &>;
+      /**
+       * Load the missing blocks from several peers at once and apply them
+       * @param start_height - the block from which to start synchronization
+       * @param target_height - the last block to load
+       * @param public_keys - public keys of peers from which to ask the blocks
+       * @return Result of committing the downloaded blocks, which may end
+       * below target_height if some blocks were not provided by any peer
+       */
+      ametsuchi::CommitResult downloadAndCommitInParallel(
+          const shared_model::interface::types::HeightType start_height,
+          const shared_model::interface::types::HeightType target_height,
+          const PublicKeysRange &public_keys);
+
       /**
        * Iterate through the peers which signed the commit message, load and
        * apply the missing blocks
@@ -79,6 +93,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      ParallelBlockDownloader block_downloader_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
@@ -56,6 +56,17 @@ namespace torii {
         const iroha::protocol::TxStatusRequest &tx,
         std::vector<iroha::protocol::ToriiResponse> &response) const;
 
+    /**
+     * Acquires streams of statuses of several transactions from the request
+     * moment until final over a single connection.
+     * @param txs - transactions to track.
+     * @param response - vector of all statuses of the transactions in the
+     * order of receiving.
+     */
+    void ListStatusStream(
+        const iroha::protocol::TxStatusRequestList &txs,
+        std::vector<iroha::protocol::ToriiResponse> &response) const;
+
    private:
     std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface> stub_;
     logger::LoggerPtr log_;
@@ -57,4 +57,19 @@ namespace torii {
     reader->Finish();
   }
 
+  void CommandSyncClient::ListStatusStream(
+      const iroha::protocol::TxStatusRequestList &txs,
+      std::vector<iroha::protocol::ToriiResponse> &response) const {
+    grpc::ClientContext context;
+    ToriiResponse resp;
+    auto reader = stub_->ListStatusStream(&context, txs);
+    while (reader->Read(&resp)) {
+      log_->debug("received new status: {}, hash {}",
+                  resp.tx_status(),
+                  iroha::bytestringToHexstring(resp.tx_hash()));
+      response.push_back(resp);
+    }
+    reader->Finish();
+  }
+
 }  // namespace torii
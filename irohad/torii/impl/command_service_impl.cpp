@@ -5,7 +5,6 @@
 
 #include "torii/impl/command_service_impl.hpp"
 
-#include <rxcpp/operators/rx-filter.hpp>
 #include <rxcpp/operators/rx-start_with.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "common/byteutils.hpp"
@@ -157,13 +156,9 @@ namespace iroha {
             });
       }());
       return status_bus_
-          ->statuses()
+          ->statuses(hash)
           // prepend initial status
           .start_with(initial_status)
-          // select statuses with requested hash
-          .filter([hash](auto response) {
-            return response->transactionHash() == hash;
-          })
           // successfully complete the observable if final status is received.
           // final status is included in the observable
           .template lift<ResponsePtrType>(
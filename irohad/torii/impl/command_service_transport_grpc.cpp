@@ -7,26 +7,39 @@
 
 #include "torii/impl/command_service_transport_grpc.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <iterator>
+#include <mutex>
 
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <rxcpp/operators/rx-filter.hpp>
+#include <rxcpp/operators/rx-map.hpp>
+#include <rxcpp/operators/rx-merge.hpp>
 #include <rxcpp/operators/rx-start_with.hpp>
 #include <rxcpp/operators/rx-take_while.hpp>
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
-#include "common/run_loop_handler.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "torii/impl/status_stream_call.hpp"
 #include "torii/status_bus.hpp"
 
+namespace {
+  // indices of the methods of CommandService_v1 in endpoint.proto
+  constexpr int kStatusStreamMethodIndex = 3;
+  constexpr int kListStatusStreamMethodIndex = 4;
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -36,6 +49,8 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::TxStatusFactory>
             status_factory,
         std::shared_ptr<TransportFactoryType> transaction_factory,
+        std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+            transaction_builder,
         std::shared_ptr<shared_model::interface::TransactionBatchParser>
             batch_parser,
         std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -47,6 +62,7 @@ namespace iroha {
           status_bus_(std::move(status_bus)),
           status_factory_(std::move(status_factory)),
           transaction_factory_(std::move(transaction_factory)),
+          transaction_builder_(std::move(transaction_builder)),
           batch_parser_(std::move(batch_parser)),
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
@@ -100,8 +116,9 @@ namespace iroha {
     CommandServiceTransportGrpc::deserializeTransactions(
         const iroha::protocol::TxList *request) {
       shared_model::interface::types::SharedTxsCollectionType tx_collection;
-      for (const auto &tx : request->transactions()) {
-        transaction_factory_->build(tx).match(
+      for (auto &result : transaction_builder_->build(
+               *transaction_factory_, request->transactions())) {
+        std::move(result).match(
             [&tx_collection](auto &&v) {
               tx_collection.emplace_back(std::move(v).value);
             },
@@ -169,85 +186,214 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxStatusRequest *request,
         grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
-      rxcpp::schedulers::run_loop rl;
+      writeStatusUpdates(context, hashesOf(*request), response_writer);
+      return grpc::Status::OK;
+    }
 
-      auto current_thread = rxcpp::synchronize_in_one_worker(
-          rxcpp::schedulers::make_run_loop(rl));
+    grpc::Status CommandServiceTransportGrpc::ListStatusStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxStatusRequestList *request,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      writeStatusUpdates(context, hashesOf(*request), response_writer);
+      return grpc::Status::OK;
+    }
 
-      rxcpp::composite_subscription subscription;
+    std::function<std::function<void()>(grpc::ServerCompletionQueue *)>
+    CommandServiceTransportGrpc::serveStatusStreamsAsync() {
+      MarkMethodAsync(kStatusStreamMethodIndex);
+      MarkMethodAsync(kListStatusStreamMethodIndex);
+      return [this](grpc::ServerCompletionQueue *completion_queue) {
+        auto queue_guard = std::make_shared<CompletionQueueGuard>();
+        requestStatusStreamCall<iroha::protocol::TxStatusRequest>(
+            kStatusStreamMethodIndex, completion_queue, queue_guard);
+        requestStatusStreamCall<iroha::protocol::TxStatusRequestList>(
+            kListStatusStreamMethodIndex, completion_queue, queue_guard);
+        return [queue_guard] { queue_guard->close(); };
+      };
+    }
 
-      auto hash = shared_model::crypto::Hash::fromHexString(request->tx_hash());
+    template <typename Request>
+    void CommandServiceTransportGrpc::requestStatusStreamCall(
+        int method_index,
+        grpc::ServerCompletionQueue *completion_queue,
+        std::shared_ptr<CompletionQueueGuard> queue_guard) {
+      StatusStreamCall<Request>::request(
+          [this, method_index, completion_queue](
+              grpc::ServerContext *context,
+              Request *request,
+              grpc::ServerAsyncWriter<iroha::protocol::ToriiResponse> *writer,
+              void *tag) {
+            this->RequestAsyncServerStreaming(method_index,
+                                              context,
+                                              request,
+                                              writer,
+                                              completion_queue,
+                                              completion_queue,
+                                              tag);
+          },
+          [this](const grpc::ServerContext &context, const Request &request) {
+            return this->statusUpdates(context.peer(), hashesOf(request));
+          },
+          std::move(queue_guard));
+    }
 
-      auto client_id_format = boost::format("Peer: '%s', %s");
-      std::string client_id =
-          (client_id_format % context->peer() % hash.toString()).str();
-      auto status_bus = command_service_->getStatusStream(hash);
+    std::vector<shared_model::crypto::Hash>
+    CommandServiceTransportGrpc::hashesOf(
+        const iroha::protocol::TxStatusRequest &request) {
+      return {shared_model::crypto::Hash::fromHexString(request.tx_hash())};
+    }
+
+    std::vector<shared_model::crypto::Hash>
+    CommandServiceTransportGrpc::hashesOf(
+        const iroha::protocol::TxStatusRequestList &request) {
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(request.requests_size());
+      for (const auto &tx_request : request.requests()) {
+        auto hash =
+            shared_model::crypto::Hash::fromHexString(tx_request.tx_hash());
+        // a transaction requested twice is tracked once
+        if (std::find(hashes.begin(), hashes.end(), hash) == hashes.end()) {
+          hashes.push_back(std::move(hash));
+        }
+      }
+      return hashes;
+    }
+
+    rxcpp::observable<iroha::protocol::ToriiResponse>
+    CommandServiceTransportGrpc::statusUpdates(
+        const std::string &peer,
+        const std::vector<shared_model::crypto::Hash> &hashes) {
       auto consensus_gate_observable =
           consensus_gate_objects_
               // a dummy start_with lets us don't wait for the consensus event
               // on further combine_latest
               .start_with(ConsensusGateEvent{});
 
-      boost::optional<iroha::protocol::TxStatus> last_tx_status;
-      auto rounds_counter{0};
-      makeCombineLatestUntilFirstCompleted(
-          status_bus,
-          current_thread,
-          [](auto status, auto) { return status; },
-          consensus_gate_observable)
-          // complete the observable if client is disconnected or too many
-          // rounds have passed without tx status change
-          .take_while([=, &rounds_counter, &last_tx_status](
-                          const auto &response) {
-            const auto &proto_response =
-                std::static_pointer_cast<
-                    shared_model::proto::TransactionResponse>(response)
-                    ->getTransport();
-
-            if (context->IsCancelled()) {
-              log_->debug("client unsubscribed, {}", client_id);
-              return false;
-            }
-
-            // increment round counter when the same status arrived again.
-            auto status = proto_response.tx_status();
-            auto status_is_same =
-                last_tx_status and (status == *last_tx_status);
-            if (status_is_same) {
-              ++rounds_counter;
-              if (rounds_counter >= maximum_rounds_without_update_) {
-                // we stop the stream when round counter is greater than
-                // allowed.
-                return false;
-              }
-              // omit the received status, but do not stop the stream
-              return true;
-            }
-            rounds_counter = 0;
-            last_tx_status = status;
-
-            // write a new status to the stream
-            if (not response_writer->Write(proto_response)) {
-              log_->error("write to stream has failed to client {}", client_id);
-              return false;
-            }
-            log_->debug("status written, {}", client_id);
-            return true;
-          })
+      /// Last status of a single transaction
+      struct LastStatus {
+        boost::optional<iroha::protocol::TxStatus> tx_status;
+        int rounds_counter{0};
+        bool is_update{false};
+      };
+
+      auto client_id_format = boost::format("Peer: '%s', %s");
+      std::vector<rxcpp::observable<iroha::protocol::ToriiResponse>>
+          status_streams;
+      status_streams.reserve(hashes.size());
+      for (const auto &hash : hashes) {
+        std::string client_id =
+            (client_id_format % peer % hash.toString()).str();
+        auto last_status = std::make_shared<LastStatus>();
+        status_streams.push_back(
+            makeCombineLatestUntilFirstCompleted(
+                command_service_->getStatusStream(hash),
+                // serializes the statuses and the consensus events on the
+                // threads which emit them
+                rxcpp::serialize_event_loop(),
+                [](auto status, auto) { return status; },
+                consensus_gate_observable)
+                .map([](const auto &response) {
+                  return std::static_pointer_cast<
+                             shared_model::proto::TransactionResponse>(
+                             response)
+                      ->getTransport();
+                })
+                // complete the observable if too many rounds have passed
+                // without tx status change
+                .take_while([this, last_status, client_id](
+                                const auto &proto_response) {
+                  // increment round counter when the same status arrived
+                  // again.
+                  auto status = proto_response.tx_status();
+                  if (last_status->tx_status
+                      and status == *last_status->tx_status) {
+                    last_status->is_update = false;
+                    if (++last_status->rounds_counter
+                        >= maximum_rounds_without_update_) {
+                      // we stop the stream when round counter is greater
+                      // than allowed.
+                      log_->debug("stream is stale, {}", client_id);
+                      return false;
+                    }
+                    return true;
+                  }
+                  last_status->rounds_counter = 0;
+                  last_status->tx_status = status;
+                  last_status->is_update = true;
+                  return true;
+                })
+                // omit the repeated statuses
+                .filter([last_status](const auto &) {
+                  return last_status->is_update;
+                })
+                .as_dynamic());
+      }
+
+      return rxcpp::observable<>::iterate(status_streams)
+          .merge(rxcpp::serialize_event_loop());
+    }
+
+    void CommandServiceTransportGrpc::writeStatusUpdates(
+        grpc::ServerContext *context,
+        const std::vector<shared_model::crypto::Hash> &hashes,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      /// Responses passed from the emitting threads to the writing one
+      struct WriteQueue {
+        std::mutex mutex;
+        std::condition_variable updated;
+        std::deque<iroha::protocol::ToriiResponse> responses;
+        bool completed{false};
+      };
+      auto queue = std::make_shared<WriteQueue>();
+      auto complete = [queue] {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->completed = true;
+        queue->updated.notify_one();
+      };
+
+      auto client_id = context->peer();
+      rxcpp::composite_subscription subscription;
+      statusUpdates(client_id, hashes)
           .subscribe(subscription,
-                     [](const auto &) {},
-                     [&](std::exception_ptr ep) {
+                     [queue](const auto &response) {
+                       std::lock_guard<std::mutex> lock(queue->mutex);
+                       queue->responses.push_back(response);
+                       queue->updated.notify_one();
+                     },
+                     [this, complete, client_id](std::exception_ptr ep) {
                        log_->error("something bad happened, client_id {}",
                                    client_id);
+                       complete();
                      },
-                     [&] { log_->debug("stream done, {}", client_id); });
+                     complete);
+
+      std::unique_lock<std::mutex> lock(queue->mutex);
+      while (true) {
+        queue->updated.wait(lock, [&queue] {
+          return queue->completed or not queue->responses.empty();
+        });
+        if (queue->responses.empty()) {
+          break;
+        }
+        auto response = std::move(queue->responses.front());
+        queue->responses.pop_front();
+        lock.unlock();
 
-      // run loop while subscription is active or there are pending events in
-      // the queue
-      iroha::schedulers::handleEvents(subscription, rl);
+        if (context->IsCancelled()) {
+          log_->debug("client unsubscribed, {}", client_id);
+          break;
+        }
+        // write a new status to the stream
+        if (not response_writer->Write(response)) {
+          log_->error("write to stream has failed to client {}", client_id);
+          break;
+        }
+        log_->debug("status written, {}", client_id);
+        lock.lock();
+      }
+      subscription.unsubscribe();
 
       log_->debug("status stream done, {}", client_id);
-      return grpc::Status::OK;
     }
   }  // namespace torii
 }  // namespace iroha
@@ -8,6 +8,8 @@
 
 #include "torii/command_service.hpp"
 
+#include <functional>
+
 #include <rxcpp/rx-lite.hpp>
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
@@ -17,6 +19,7 @@
 
 namespace iroha {
   namespace torii {
+    class CompletionQueueGuard;
     class StatusBus;
   }
 }  // namespace iroha
@@ -26,6 +29,7 @@ namespace shared_model {
     class TxStatusFactory;
     class TransactionBatchParser;
     class TransactionBatchFactory;
+    class ParallelTransportBuilder;
   }  // namespace interface
 }  // namespace shared_model
 
@@ -47,6 +51,7 @@ namespace iroha {
        * @param status_bus is a common notifier for tx statuses
        * @param status_factory - factory of statuses
        * @param transaction_factory - factory of transactions
+       * @param transaction_builder - pool to build received transactions on
        * @param batch_parser - parses of batches
        * @param transaction_batch_factory - factory of batchesof transactions
        * @param consensus_gate_objects - events from consensus gate
@@ -60,6 +65,8 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::TxStatusFactory>
               status_factory,
           std::shared_ptr<TransportFactoryType> transaction_factory,
+          std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+              transaction_builder,
           std::shared_ptr<shared_model::interface::TransactionBatchParser>
               batch_parser,
           std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -118,7 +125,80 @@ namespace iroha {
           grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
           override;
 
+      /**
+       * StatusStream call via grpc for several transactions at once
+       * @param context - call context
+       * @param request - TxStatusRequest objects which identify transactions
+       * @param response_writer - grpc::ServerWriter which repeatedly sends
+       * statuses of all requested transactions back to the client
+       * @return status
+       */
+      grpc::Status ListStatusStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxStatusRequestList *request,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
+          override;
+
+      /**
+       * Serve StatusStream and ListStatusStream calls on the completion queue
+       * of the server instead of the synchronous handlers, so an idle status
+       * stream does not hold a server thread. Must be called before the
+       * service is registered, and the service can be registered in a single
+       * server only
+       * @return function which starts serving the calls on the completion
+       * queue of the server, and returns a function to stop starting new
+       * operations on the queue before it is shut down
+       */
+      std::function<std::function<void()>(grpc::ServerCompletionQueue *)>
+      serveStatusStreamsAsync();
+
      private:
+      /**
+       * Wait for a new asynchronous status stream call
+       * @tparam Request - type of the request message of the method
+       * @param method_index - index of the method in the service
+       * @param completion_queue - completion queue of the server
+       * @param queue_guard - guard of the completion queue
+       */
+      template <typename Request>
+      void requestStatusStreamCall(
+          int method_index,
+          grpc::ServerCompletionQueue *completion_queue,
+          std::shared_ptr<CompletionQueueGuard> queue_guard);
+
+      /// @return hashes of the requested transactions
+      static std::vector<shared_model::crypto::Hash> hashesOf(
+          const iroha::protocol::TxStatusRequest &request);
+
+      /// @return hashes of the requested transactions without duplicates
+      static std::vector<shared_model::crypto::Hash> hashesOf(
+          const iroha::protocol::TxStatusRequestList &request);
+
+      /**
+       * Updates of the statuses of given transactions. The stream of a
+       * transaction completes when its status is final or does not change
+       * for maximum_rounds_without_update_ rounds
+       * @param peer - address of the client
+       * @param hashes - hashes of the transactions
+       * @return new statuses of the transactions, emitted on the threads which
+       * produce them
+       */
+      rxcpp::observable<iroha::protocol::ToriiResponse> statusUpdates(
+          const std::string &peer,
+          const std::vector<shared_model::crypto::Hash> &hashes);
+
+      /**
+       * Write status updates of given transactions on the calling thread
+       * until every status stream is completed or the client is disconnected
+       * @param context - call context
+       * @param hashes - hashes of the transactions
+       * @param response_writer - writer of the statuses
+       */
+      void writeStatusUpdates(
+          grpc::ServerContext *context,
+          const std::vector<shared_model::crypto::Hash> &hashes,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer);
+
       /**
        * Flat map transport transactions to shared model
        */
@@ -129,6 +209,8 @@ namespace iroha {
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
       std::shared_ptr<shared_model::interface::TxStatusFactory> status_factory_;
       std::shared_ptr<TransportFactoryType> transaction_factory_;
+      std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+          transaction_builder_;
       std::shared_ptr<shared_model::interface::TransactionBatchParser>
           batch_parser_;
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -8,7 +8,14 @@
 namespace iroha {
   namespace torii {
     StatusBusImpl::StatusBusImpl(rxcpp::observe_on_one_worker worker)
-        : worker_(worker), subject_(worker_, cs_) {}
+        : worker_(worker),
+          subject_(worker_, cs_),
+          subscriptions_(std::make_shared<Subscriptions>()) {
+      cs_.add(subject_.get_observable().subscribe(
+          [subscriptions = subscriptions_](const auto &status) {
+            dispatch(*subscriptions, status);
+          }));
+    }
 
     StatusBusImpl::~StatusBusImpl() {
       cs_.unsubscribe();
@@ -21,5 +28,62 @@ namespace iroha {
     rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses() {
       return subject_.get_observable();
     }
+
+    rxcpp::observable<StatusBus::Objects> StatusBusImpl::statuses(
+        const shared_model::crypto::Hash &hash) {
+      std::weak_ptr<Subscriptions> weak_subscriptions = subscriptions_;
+      return rxcpp::observable<>::create<StatusBus::Objects>(
+          [weak_subscriptions,
+           hash](rxcpp::subscriber<StatusBus::Objects> subscriber) {
+            auto subscriptions = weak_subscriptions.lock();
+            if (not subscriptions) {
+              return;
+            }
+            size_t id;
+            {
+              std::lock_guard<std::mutex> lock(subscriptions->mutex);
+              id = subscriptions->next_id++;
+              subscriptions->subscribers[hash].emplace(id, subscriber);
+            }
+            // invoked immediately if the subscriber is already unsubscribed,
+            // so the mutex must not be held here
+            subscriber.add([weak_subscriptions, hash, id] {
+              auto subscriptions = weak_subscriptions.lock();
+              if (not subscriptions) {
+                return;
+              }
+              std::lock_guard<std::mutex> lock(subscriptions->mutex);
+              auto it = subscriptions->subscribers.find(hash);
+              if (it == subscriptions->subscribers.end()) {
+                return;
+              }
+              it->second.erase(id);
+              if (it->second.empty()) {
+                subscriptions->subscribers.erase(it);
+              }
+            });
+          });
+    }
+
+    void StatusBusImpl::dispatch(Subscriptions &subscriptions,
+                                 const StatusBus::Objects &status) {
+      std::vector<rxcpp::subscriber<StatusBus::Objects>> subscribers;
+      {
+        std::lock_guard<std::mutex> lock(subscriptions.mutex);
+        auto it = subscriptions.subscribers.find(status->transactionHash());
+        if (it == subscriptions.subscribers.end()) {
+          return;
+        }
+        subscribers.reserve(it->second.size());
+        for (const auto &subscriber : it->second) {
+          subscribers.push_back(subscriber.second);
+        }
+      }
+      // subscribers may unsubscribe on a status, so they are called without
+      // holding the mutex
+      for (auto &subscriber : subscribers) {
+        subscriber.on_next(status);
+      }
+    }
   }  // namespace torii
 }  // namespace iroha
@@ -8,6 +8,9 @@
 
 #include "torii/status_bus.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 #include <rxcpp/rx-lite.hpp>
 
 #include <rxcpp/operators/rx-observe_on.hpp>
@@ -15,7 +18,9 @@
 namespace iroha {
   namespace torii {
     /**
-     * StatusBus implementation
+     * StatusBus implementation. Subscribers of the statuses of a single
+     * transaction are registered by its hash, so each published status is
+     * dispatched only to the subscribers of its transaction
      */
     class StatusBusImpl : public StatusBus {
      public:
@@ -27,12 +32,33 @@ namespace iroha {
       void publish(StatusBus::Objects) override;
       /// Subscribers will be invoked in separate thread
       rxcpp::observable<StatusBus::Objects> statuses() override;
+      /// Subscribers will be invoked in separate thread
+      rxcpp::observable<StatusBus::Objects> statuses(
+          const shared_model::crypto::Hash &hash) override;
 
       // Need to create once, otherwise will create thread for each subscriber
       rxcpp::observe_on_one_worker worker_;
       rxcpp::composite_subscription cs_;
       rxcpp::subjects::synchronize<StatusBus::Objects, decltype(worker_)>
           subject_;
+
+     private:
+      /// Subscribers of the statuses of single transactions
+      struct Subscriptions {
+        std::mutex mutex;
+        size_t next_id = 0;
+        std::unordered_map<
+            shared_model::crypto::Hash,
+            std::unordered_map<size_t, rxcpp::subscriber<StatusBus::Objects>>,
+            shared_model::crypto::Hash::Hasher>
+            subscribers;
+      };
+
+      /// Pass the status to the subscribers of its transaction
+      static void dispatch(Subscriptions &subscriptions,
+                           const StatusBus::Objects &status);
+
+      std::shared_ptr<Subscriptions> subscriptions_;
     };
   }  // namespace torii
 }  // namespace iroha
@@ -0,0 +1,283 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_STATUS_STREAM_CALL_HPP
+#define TORII_STATUS_STREAM_CALL_HPP
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <grpc++/grpc++.h>
+#include <rxcpp/rx-lite.hpp>
+#include "endpoint.grpc.pb.h"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Lets operations be started on a completion queue only until it is
+     * closed. The queue must be closed before it is shut down, since no
+     * operation may be started on a queue which is shut down.
+     */
+    class CompletionQueueGuard {
+     public:
+      /// Forbid new operations, waiting for those being started
+      void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+      }
+
+      /**
+       * Start an operation unless the queue is closed
+       * @param start - places the operation on the queue
+       * @return false if the queue is closed and the operation is not started
+       */
+      template <typename Start>
+      bool start(Start &&start) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+          return false;
+        }
+        std::forward<Start>(start)();
+        return true;
+      }
+
+     private:
+      std::mutex mutex_;
+      bool closed_ = false;
+    };
+
+    /**
+     * Status stream call served on a completion queue. Status updates are
+     * pushed to the write queue of the call by the threads which produce
+     * them and are written one at a time, so an idle call holds only memory
+     * and no thread. The call owns itself from the request until every
+     * operation it placed on the completion queue is delivered.
+     * Completion queue tags point to CompletionHandler members, and the
+     * handlers of a call are expected to be invoked by a single thread.
+     * @tparam Request - type of the request message
+     */
+    template <typename Request>
+    class StatusStreamCall
+        : public std::enable_shared_from_this<StatusStreamCall<Request>> {
+     public:
+      using Response = iroha::protocol::ToriiResponse;
+      using CompletionHandler = std::function<void(bool)>;
+
+      /// Requests a new call from the server with the given tag
+      using RequestCall =
+          std::function<void(grpc::ServerContext *,
+                             Request *,
+                             grpc::ServerAsyncWriter<Response> *,
+                             void *)>;
+
+      /// Creates the stream of responses to write for a started call
+      using StatusUpdates = std::function<rxcpp::observable<Response>(
+          const grpc::ServerContext &, const Request &)>;
+
+      /**
+       * Wait for a new call. When it arrives, the next one is awaited
+       * @param request_call - requests the call from the server
+       * @param status_updates - responses for the request
+       * @param queue_guard - guard of the completion queue. Once it is
+       * closed, no call is requested and no response is written
+       */
+      static void request(RequestCall request_call,
+                          StatusUpdates status_updates,
+                          std::shared_ptr<CompletionQueueGuard> queue_guard) {
+        std::shared_ptr<StatusStreamCall> call(
+            new StatusStreamCall(std::move(request_call),
+                                 std::move(status_updates),
+                                 std::move(queue_guard)));
+        call->queue_guard_->start([&call] {
+          call->self_ = call;
+          call->pending_operations_ = 1;
+          call->context_.AsyncNotifyWhenDone(&call->on_done_);
+          call->request_call_(&call->context_,
+                              &call->request_,
+                              &call->writer_,
+                              &call->on_requested_);
+        });
+      }
+
+      ~StatusStreamCall() {
+        subscription_.unsubscribe();
+      }
+
+     private:
+      StatusStreamCall(RequestCall request_call,
+                       StatusUpdates status_updates,
+                       std::shared_ptr<CompletionQueueGuard> queue_guard)
+          : request_call_(std::move(request_call)),
+            status_updates_(std::move(status_updates)),
+            queue_guard_(std::move(queue_guard)),
+            writer_(&context_),
+            on_requested_([this](bool ok) { onRequested(ok); }),
+            on_written_([this](bool ok) { onWritten(ok); }),
+            on_finished_([this](bool) { onFinished(); }),
+            on_done_([this](bool) { onDone(); }) {}
+
+      void onRequested(bool ok) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        --pending_operations_;
+        if (not ok) {
+          // the server is shutting down, the done tag is not delivered for
+          // a call which has not started
+          release(lock);
+          return;
+        }
+        // the done tag is delivered for every started call
+        ++pending_operations_;
+        lock.unlock();
+
+        // the next call is not requested if the server is shutting down
+        request(request_call_, status_updates_, queue_guard_);
+
+        std::weak_ptr<StatusStreamCall> weak_call = this->shared_from_this();
+        status_updates_(context_, request_).subscribe(
+            subscription_,
+            [weak_call](const Response &response) {
+              if (auto call = weak_call.lock()) {
+                call->push(response);
+              }
+            },
+            [weak_call](std::exception_ptr) {
+              if (auto call = weak_call.lock()) {
+                call->complete();
+              }
+            },
+            [weak_call] {
+              if (auto call = weak_call.lock()) {
+                call->complete();
+              }
+            });
+      }
+
+      void push(const Response &response) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (done_ or completed_) {
+          return;
+        }
+        write_queue_.push_back(response);
+        if (not writing_) {
+          writeNext();
+        }
+      }
+
+      void complete() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (done_ or completed_) {
+          return;
+        }
+        completed_ = true;
+        if (not writing_) {
+          finish();
+        }
+      }
+
+      void onWritten(bool ok) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        --pending_operations_;
+        writing_ = false;
+        write_queue_.pop_front();
+        if (not ok) {
+          // the call is dead
+          write_queue_.clear();
+          completed_ = true;
+          lock.unlock();
+          subscription_.unsubscribe();
+          lock.lock();
+          release(lock);
+          return;
+        }
+        if (done_) {
+          write_queue_.clear();
+          release(lock);
+        } else if (not write_queue_.empty()) {
+          writeNext();
+        } else if (completed_) {
+          finish();
+        }
+      }
+
+      void onFinished() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        --pending_operations_;
+        release(lock);
+      }
+
+      void onDone() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        --pending_operations_;
+        done_ = true;
+        lock.unlock();
+        subscription_.unsubscribe();
+        lock.lock();
+        release(lock);
+      }
+
+      /// Write the first response of the queue, the mutex must be held
+      void writeNext() {
+        if (not queue_guard_->start([this] {
+              writer_.Write(write_queue_.front(), &on_written_);
+            })) {
+          // the server is shutting down and cancels the call
+          write_queue_.clear();
+          completed_ = true;
+          return;
+        }
+        writing_ = true;
+        ++pending_operations_;
+      }
+
+      /// Finish the call, the mutex must be held
+      void finish() {
+        if (queue_guard_->start([this] {
+              writer_.Finish(grpc::Status::OK, &on_finished_);
+            })) {
+          ++pending_operations_;
+        }
+      }
+
+      /// Destroy the call if no operation is pending
+      void release(std::unique_lock<std::mutex> &lock) {
+        if (pending_operations_ != 0) {
+          return;
+        }
+        auto self = std::move(self_);
+        lock.unlock();
+      }
+
+      RequestCall request_call_;
+      StatusUpdates status_updates_;
+      std::shared_ptr<CompletionQueueGuard> queue_guard_;
+
+      grpc::ServerContext context_;
+      Request request_;
+      grpc::ServerAsyncWriter<Response> writer_;
+
+      CompletionHandler on_requested_;
+      CompletionHandler on_written_;
+      CompletionHandler on_finished_;
+      CompletionHandler on_done_;
+
+      rxcpp::composite_subscription subscription_;
+
+      std::mutex mutex_;
+      std::deque<Response> write_queue_;
+      size_t pending_operations_ = 0;
+      bool writing_ = false;
+      bool completed_ = false;
+      bool done_ = false;
+      std::shared_ptr<StatusStreamCall> self_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_STATUS_STREAM_CALL_HPP
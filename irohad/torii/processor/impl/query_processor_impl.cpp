@@ -45,7 +45,12 @@ namespace iroha {
                                                      response_factory_);
       if (not executor) {
         log_->error("Cannot create query executor");
-        return nullptr;
+        return response_factory_->createErrorQueryResponse(
+            shared_model::interface::QueryResponseFactory::ErrorQueryType::
+                kStatefulFailed,
+            "Cannot create query executor",
+            1,
+            qry.hash());
       }
 
       return executor.value()->validateAndExecute(qry, true);
@@ -0,0 +1,153 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARDED_LRU_CACHE_HPP
+#define IROHA_SHARDED_LRU_CACHE_HPP
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Thread-safe cache with least recently used eviction. Keys are spread
+     * over shards with a lock each, so concurrent accesses to different
+     * shards do not contend. A shard evicts its least recently used item
+     * when an item is added to a full shard, one item at a time.
+     * @tparam KeyType - type of cache keys
+     * @tparam ValueType - type of cache values
+     * @tparam KeyHash - hasher for keys
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    class ShardedLruCache {
+     public:
+      /// Default maximal number of items
+      static constexpr size_t kDefaultCapacity = 20000;
+
+      /// Default number of shards
+      static constexpr size_t kDefaultShards = 16;
+
+      /**
+       * @param capacity - maximal number of items, at least 1
+       * @param shards - number of independently locked shards, the capacity
+       * is divided between them
+       */
+      explicit ShardedLruCache(size_t capacity = kDefaultCapacity,
+                               size_t shards = kDefaultShards)
+          : shard_capacity_(0) {
+        capacity = std::max<size_t>(capacity, 1);
+        shards = std::min(std::max<size_t>(shards, 1), capacity);
+        shard_capacity_ = (capacity + shards - 1) / shards;
+        shards_.reserve(shards);
+        for (size_t i = 0; i < shards; ++i) {
+          shards_.push_back(std::make_unique<Shard>());
+        }
+      }
+
+      /**
+       * @return maximal number of items in cache
+       */
+      size_t getCapacity() const {
+        return shard_capacity_ * shards_.size();
+      }
+
+      /**
+       * @return amount of items in cache
+       */
+      uint32_t getCacheItemCount() const {
+        size_t count = 0;
+        for (const auto &shard : shards_) {
+          std::lock_guard<std::mutex> lock(shard->mutex);
+          count += shard->index.size();
+        }
+        return static_cast<uint32_t>(count);
+      }
+
+      /**
+       * Adds an item to cache or replaces the value of the existing one. The
+       * item becomes the most recently used. If the shard of the key is full,
+       * its least recently used item is removed
+       * @param key - key to insert
+       * @param value - value to insert
+       */
+      void addItem(const KeyType &key, const ValueType &value) {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(key);
+        if (found != shard.index.end()) {
+          found->second->second = value;
+          shard.items.splice(shard.items.begin(), shard.items, found->second);
+          return;
+        }
+        if (shard.index.size() >= shard_capacity_) {
+          shard.index.erase(shard.items.back().first);
+          shard.items.pop_back();
+        }
+        shard.items.emplace_front(key, value);
+        shard.index.emplace(key, shard.items.begin());
+      }
+
+      /**
+       * Performs a search for an item with a specific key. A found item
+       * becomes the most recently used
+       * @param key - key to find
+       * @return Optional of ValueType
+       */
+      boost::optional<ValueType> findItem(const KeyType &key) const {
+        auto &shard = shardOf(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(key);
+        if (found == shard.index.end()) {
+          return boost::none;
+        }
+        shard.items.splice(shard.items.begin(), shard.items, found->second);
+        return found->second->second;
+      }
+
+     private:
+      /// Items of a part of the key space ordered by recency of use
+      struct Shard {
+        using Items = std::list<std::pair<KeyType, ValueType>>;
+
+        std::mutex mutex;
+        /// the most recently used item is the first
+        Items items;
+        std::unordered_map<KeyType, typename Items::iterator, KeyHash> index;
+      };
+
+      Shard &shardOf(const KeyType &key) const {
+        // the low bits of the hash select a bucket of the shard index, so the
+        // shard is selected by the mixed high bits
+        auto mixed =
+            static_cast<uint64_t>(hasher_(key)) * 0x9E3779B97F4A7C15ull;
+        return *shards_[(mixed >> 32) % shards_.size()];
+      }
+
+      KeyHash hasher_;
+      size_t shard_capacity_;
+      std::vector<std::unique_ptr<Shard>> shards_;
+    };
+
+    template <typename KeyType, typename ValueType, typename KeyHash>
+    constexpr size_t
+        ShardedLruCache<KeyType, ValueType, KeyHash>::kDefaultCapacity;
+
+    template <typename KeyType, typename ValueType, typename KeyHash>
+    constexpr size_t
+        ShardedLruCache<KeyType, ValueType, KeyHash>::kDefaultShards;
+
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_SHARDED_LRU_CACHE_HPP
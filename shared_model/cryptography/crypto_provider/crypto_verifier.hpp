@@ -7,6 +7,7 @@
 #define IROHA_CRYPTO_VERIFIER_HPP
 
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -36,6 +37,17 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify a batch of signatures at once, which is cheaper than verifying
+       * them one by one
+       * @param batch - signatures together with signed data and signatories
+       * @return indices of the entries with incorrect signatures, empty if
+       * every signature in the batch is correct
+       */
+      static VerificationFailures verifyBatch(const VerificationBatch &batch) {
+        return Algorithm::verifyBatch(batch);
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
@@ -9,6 +9,7 @@
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -35,6 +36,14 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies a batch of signatures.
+       * @param batch - signatures with original messages and public keys
+       * @return indices of the batch entries which failed verification
+       */
+      static VerificationFailures verifyBatch(const VerificationBatch &batch);
+
       /**
        * Generates new seed
        * @return Seed generated
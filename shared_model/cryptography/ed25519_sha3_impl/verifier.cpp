@@ -4,9 +4,30 @@
  */
 
 #include "verifier.hpp"
+
+#include <algorithm>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
+namespace {
+  /**
+   * Copy bytes of the blob to the fixed-size blob if sizes match
+   * @return true if the blob was copied
+   */
+  template <size_t size>
+  bool copyBlob(const shared_model::crypto::Blob &from,
+                iroha::blob_t<size> &to) {
+    if (from.blob().size() != size) {
+      return false;
+    }
+    std::copy(from.blob().begin(), from.blob().end(), to.begin());
+    return true;
+  }
+}  // namespace
+
 namespace shared_model {
   namespace crypto {
     bool Verifier::verify(const Signed &signedData,
@@ -17,5 +38,59 @@ namespace shared_model {
           iroha::pubkey_t::from_string(toBinaryString(publicKey)),
           iroha::sig_t::from_string(toBinaryString(signedData)));
     }
+
+    VerificationFailures Verifier::verifyBatch(const VerificationBatch &batch) {
+      // signatures of one transaction and votes of one commit share the signed
+      // message, so consecutive equal messages are hashed only once
+      std::vector<size_t> digest_of_entry(batch.size());
+      std::vector<size_t> message_entries;
+      for (size_t i = 0; i < batch.size(); ++i) {
+        const auto &source = batch[i].source;
+        if (not message_entries.empty()) {
+          const auto &previous = batch[message_entries.back()].source;
+          if (&source == &previous or source.blob() == previous.blob()) {
+            digest_of_entry[i] = message_entries.size() - 1;
+            continue;
+          }
+        }
+        digest_of_entry[i] = message_entries.size();
+        message_entries.push_back(i);
+      }
+
+      std::vector<iroha::hash256_t> digests(message_entries.size());
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, digests.size()),
+                        [&](const auto &range) {
+                          for (auto i = range.begin(); i != range.end(); ++i) {
+                            const auto &message =
+                                batch[message_entries[i]].source.blob();
+                            digests[i] =
+                                iroha::sha3_256(message.data(), message.size());
+                          }
+                        });
+
+      std::vector<uint8_t> valid(batch.size(), 0);
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(0, batch.size()), [&](const auto &range) {
+            for (auto i = range.begin(); i != range.end(); ++i) {
+              iroha::pubkey_t public_key;
+              iroha::sig_t signature;
+              if (not copyBlob(batch[i].public_key, public_key)
+                  or not copyBlob(batch[i].signed_data, signature)) {
+                continue;
+              }
+              const auto &digest = digests[digest_of_entry[i]];
+              valid[i] = iroha::verify(
+                  digest.data(), digest.size(), public_key, signature);
+            }
+          });
+
+      VerificationFailures failures;
+      for (size_t i = 0; i < valid.size(); ++i) {
+        if (not valid[i]) {
+          failures.push_back(i);
+        }
+      }
+      return failures;
+    }
   }  // namespace crypto
 }  // namespace shared_model
@@ -8,6 +8,7 @@
 
 #include "cryptography/public_key.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -19,6 +20,14 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verify a batch of signatures. Each distinct message is hashed only
+       * once, and the signatures are checked in parallel
+       * @param batch - entries to verify
+       * @return indices of entries which failed verification
+       */
+      static VerificationFailures verifyBatch(const VerificationBatch &batch);
     };
 
   }  // namespace crypto
@@ -60,6 +60,18 @@ namespace shared_model {
       }
     }
 
+    VerificationFailures CryptoProviderEd25519Ursa::verifyBatch(
+        const VerificationBatch &batch) {
+      VerificationFailures failures;
+      for (size_t i = 0; i < batch.size(); ++i) {
+        const auto &entry = batch[i];
+        if (not verify(entry.signed_data, entry.source, entry.public_key)) {
+          failures.push_back(i);
+        }
+      }
+      return failures;
+    }
+
     Keypair CryptoProviderEd25519Ursa::generateKeypair() {
       ByteBuffer public_key;
       ByteBuffer private_key;
@@ -11,6 +11,7 @@
 #include "cryptography/public_key.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_batch.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -38,6 +39,13 @@ namespace shared_model {
                          const Blob &orig,
                          const PublicKey &public_key);
 
+      /**
+       * Verifies a batch of signatures.
+       * @param batch - signatures with original messages and public keys
+       * @return indices of the batch entries which failed verification
+       */
+      static VerificationFailures verifyBatch(const VerificationBatch &batch);
+
       /**
        * Generates new keypair with a default seed
        * @return Keypair generated
@@ -0,0 +1,41 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_VERIFICATION_BATCH_HPP
+#define IROHA_SHARED_MODEL_VERIFICATION_BATCH_HPP
+
+#include <vector>
+
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace crypto {
+    /**
+     * Single item of a batch signature verification: signature, the data that
+     * was signed and the public key of signatory. The entry does not own any
+     * of the referenced objects, so they have to outlive the verification.
+     */
+    struct VerificationEntry {
+      VerificationEntry(const Signed &signed_data,
+                        const Blob &source,
+                        const PublicKey &public_key)
+          : signed_data(signed_data),
+            source(source),
+            public_key(public_key) {}
+
+      const Signed &signed_data;
+      const Blob &source;
+      const PublicKey &public_key;
+    };
+
+    using VerificationBatch = std::vector<VerificationEntry>;
+
+    /// Indices of the entries of a batch which failed verification
+    using VerificationFailures = std::vector<size_t>;
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_VERIFICATION_BATCH_HPP
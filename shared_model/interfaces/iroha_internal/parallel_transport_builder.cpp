@@ -0,0 +1,15 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
+
+namespace shared_model {
+  namespace interface {
+
+    ParallelTransportBuilder::ParallelTransportBuilder(size_t max_concurrency)
+        : arena_(static_cast<int>(max_concurrency)) {}
+
+  }  // namespace interface
+}  // namespace shared_model
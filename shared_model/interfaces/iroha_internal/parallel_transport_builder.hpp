@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PARALLEL_TRANSPORT_BUILDER_HPP
+#define IROHA_PARALLEL_TRANSPORT_BUILDER_HPP
+
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include "interfaces/iroha_internal/abstract_transport_factory.hpp"
+
+namespace shared_model {
+  namespace interface {
+
+    /**
+     * Builds collections of transport objects, such as transaction lists
+     * received from clients and peers, on a bounded pool of worker threads.
+     * Parsing, hashing and stateless validation of the objects are spread
+     * across the workers, and the results keep the order of the input
+     * collection.
+     */
+    class ParallelTransportBuilder {
+     public:
+      /**
+       * @param max_concurrency - maximum number of threads building objects
+       * simultaneously; the pool is shared by all the users of the builder
+       */
+      explicit ParallelTransportBuilder(size_t max_concurrency);
+
+      template <typename Interface, typename Transport>
+      using ResultType = iroha::expected::Result<
+          std::unique_ptr<Interface>,
+          typename AbstractTransportFactory<Interface, Transport>::Error>;
+
+      /**
+       * Build every object of the collection with the factory
+       * @param factory - factory to build objects with, must be thread-safe
+       * @param transports - random access collection of transport objects
+       * @return results of the factory in the order of the collection
+       */
+      template <typename Interface, typename Transport, typename Collection>
+      std::vector<ResultType<Interface, Transport>> build(
+          const AbstractTransportFactory<Interface, Transport> &factory,
+          const Collection &transports) {
+        std::vector<ResultType<Interface, Transport>> results(
+            transports.size());
+        auto build_range = [&](const tbb::blocked_range<size_t> &range) {
+          for (auto i = range.begin(); i != range.end(); ++i) {
+            results[i] = factory.build(transports[i]);
+          }
+        };
+
+        // a single object is not worth the task scheduling
+        if (transports.size() < 2) {
+          build_range({0, results.size()});
+          return results;
+        }
+
+        arena_.execute([&] {
+          tbb::parallel_for(tbb::blocked_range<size_t>(0, results.size()),
+                            build_range);
+        });
+        return results;
+      }
+
+     private:
+      tbb::task_arena arena_;
+    };
+
+  }  // namespace interface
+}  // namespace shared_model
+
+#endif  // IROHA_PARALLEL_TRANSPORT_BUILDER_HPP
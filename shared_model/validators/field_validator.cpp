@@ -321,6 +321,7 @@ namespace shared_model {
       if (boost::empty(signatures)) {
         reason.second.emplace_back("Signatures cannot be empty");
       }
+      crypto::VerificationBatch batch;
       for (const auto &signature : signatures) {
         const auto &sign = signature.signedData();
         const auto &pkey = signature.publicKey();
@@ -338,14 +339,18 @@ namespace shared_model {
           is_valid = false;
         }
 
-        if (is_valid
-            && not shared_model::crypto::CryptoVerifier<>::verify(
-                   sign, source, pkey)) {
-          reason.second.push_back((boost::format("Wrong signature [%s;%s]")
-                                   % sign.hex() % pkey.hex())
-                                      .str());
+        if (is_valid) {
+          batch.emplace_back(sign, source, pkey);
         }
       }
+
+      for (auto failed :
+           shared_model::crypto::CryptoVerifier<>::verifyBatch(batch)) {
+        reason.second.push_back(
+            (boost::format("Wrong signature [%s;%s]")
+             % batch[failed].signed_data.hex() % batch[failed].public_key.hex())
+                .str());
+      }
     }
 
     void FieldValidator::validateQueryPayloadMeta(
@@ -27,6 +27,7 @@
 #include "framework/integration_framework/fake_peer/proposal_storage.hpp"
 #include "framework/result_fixture.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/server_runner.hpp"
@@ -82,6 +83,9 @@ namespace integration_framework {
           ordering_log_manager_(log_manager_->getChild("Ordering")),
           common_objects_factory_(common_objects_factory),
           transaction_factory_(transaction_factory),
+          transaction_builder_(
+              std::make_shared<
+                  shared_model::interface::ParallelTransportBuilder>(1)),
           transaction_batch_factory_(transaction_batch_factory),
           proposal_factory_(std::move(proposal_factory)),
           batch_parser_(batch_parser),
@@ -97,6 +101,7 @@ namespace integration_framework {
           mst_transport_(std::make_shared<MstTransport>(
               async_call_,
               transaction_factory,
+              transaction_builder_,
               batch_parser,
               transaction_batch_factory,
               tx_presence_cache,
@@ -143,6 +148,7 @@ namespace integration_framework {
       od_os_transport_ = std::make_shared<OdOsTransport>(
           od_os_network_notifier_,
           transaction_factory_,
+          transaction_builder_,
           batch_parser_,
           transaction_batch_factory_,
           ordering_log_manager_->getChild("Transport")->getLogger());
@@ -217,6 +217,8 @@ namespace integration_framework {
       std::shared_ptr<shared_model::interface::CommonObjectsFactory>
           common_objects_factory_;
       std::shared_ptr<TransportFactoryType> transaction_factory_;
+      std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+          transaction_builder_;
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
           transaction_batch_factory_;
       std::shared_ptr<iroha::ordering::transport::OnDemandOsClientGrpc::
@@ -45,6 +45,12 @@ namespace integration_framework {
       return {};
     }
 
+    void OnDemandOsNetworkNotifier::onPrefetchProposal(
+        iroha::consensus::Round round, ProposalCallbackType callback) {
+      // fake peer behaviours handle only requests made in the round
+      callback(boost::none);
+    }
+
     rxcpp::observable<iroha::consensus::Round>
     OnDemandOsNetworkNotifier::getProposalRequestsObservable() {
       return rounds_subject_.get_observable();
@@ -27,6 +27,9 @@ namespace integration_framework {
       virtual boost::optional<std::shared_ptr<const ProposalType>>
       onRequestProposal(iroha::consensus::Round round);
 
+      virtual void onPrefetchProposal(iroha::consensus::Round round,
+                                      ProposalCallbackType callback);
+
       rxcpp::observable<iroha::consensus::Round>
       getProposalRequestsObservable();
 
@@ -20,6 +20,7 @@ namespace shared_model {
   }  // namespace crypto
   namespace interface {
     class CommonObjectsFactory;
+    class ParallelTransportBuilder;
     class Proposal;
     class Transaction;
     class TransactionBatch;
@@ -508,8 +508,7 @@ namespace integration_framework {
     auto bar2 = std::make_shared<boost::barrier>(2);
     iroha_instance_->getIrohaInstance()
         ->getStatusBus()
-        ->statuses()
-        .filter([&](auto s) { return s->transactionHash() == tx.hash(); })
+        ->statuses(tx.hash())
         .take(1)
         .subscribe([&bar1, b2 = std::weak_ptr<boost::barrier>(bar2)](auto s) {
           bar1.wait();
@@ -55,6 +55,14 @@ namespace integration_framework {
             }())),
         max_rounds_delay_(0ms),
         stale_stream_max_rounds_(2),
+        proposal_packing_policy_(iroha::ordering::PackingPolicyType::kFifo),
+        block_store_format_(iroha::ametsuchi::BlockStoreFormat::kFlatFile),
+        block_store_sync_interval_(1),
+        pg_pool_size_(10),
+        pg_query_pool_(iroha::ametsuchi::QueryPoolOptions{
+            2, std::chrono::seconds(10)}),
+        tx_status_cache_size_(20000),
+        tx_presence_cache_size_(20000),
         irohad_log_manager_(std::move(irohad_log_manager)),
         log_(std::move(log)) {}
 
@@ -110,6 +118,15 @@ namespace integration_framework {
         key_pair,
         max_rounds_delay_,
         stale_stream_max_rounds_,
+        proposal_packing_policy_,
+        block_store_format_,
+        block_store_sync_interval_,
+        pg_pool_size_,
+        pg_query_pool_,
+        boost::none,
+        tx_status_cache_size_,
+        tx_presence_cache_size_,
+        boost::none,
         boost::none,
         irohad_log_manager_,
         log_,
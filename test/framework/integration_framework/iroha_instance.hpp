@@ -13,6 +13,8 @@
 #include <boost/optional.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/block_store_format.hpp"
+#include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -96,6 +98,13 @@ namespace integration_framework {
         opt_mst_gossip_params_;
     const std::chrono::milliseconds max_rounds_delay_;
     const size_t stale_stream_max_rounds_;
+    const iroha::ordering::PackingPolicyType proposal_packing_policy_;
+    const iroha::ametsuchi::BlockStoreFormat block_store_format_;
+    const size_t block_store_sync_interval_;
+    const size_t pg_pool_size_;
+    const boost::optional<iroha::ametsuchi::QueryPoolOptions> pg_query_pool_;
+    const size_t tx_status_cache_size_;
+    const size_t tx_presence_cache_size_;
 
    private:
     std::shared_ptr<TestIrohad> instance_;
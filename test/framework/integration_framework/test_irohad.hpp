@@ -28,6 +28,17 @@ namespace integration_framework {
                const shared_model::crypto::Keypair &keypair,
                std::chrono::milliseconds max_rounds_delay,
                size_t stale_stream_max_rounds,
+               iroha::ordering::PackingPolicyType proposal_packing_policy,
+               iroha::ametsuchi::BlockStoreFormat block_store_format,
+               size_t block_store_sync_interval,
+               size_t pg_pool_size,
+               boost::optional<iroha::ametsuchi::QueryPoolOptions>
+                   pg_query_pool,
+               boost::optional<iroha::ametsuchi::WsvCheckpointOptions>
+                   wsv_checkpoints,
+               size_t tx_status_cache_size,
+               size_t tx_presence_cache_size,
+               boost::optional<std::string> tx_presence_filter_path,
                boost::optional<shared_model::interface::types::PeerList>
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr irohad_log_manager,
@@ -48,6 +59,15 @@ namespace integration_framework {
                  keypair,
                  max_rounds_delay,
                  stale_stream_max_rounds,
+                 proposal_packing_policy,
+                 block_store_format,
+                 block_store_sync_interval,
+                 pg_pool_size,
+                 pg_query_pool,
+                 std::move(wsv_checkpoints),
+                 tx_status_cache_size,
+                 tx_presence_cache_size,
+                 std::move(tx_presence_filter_path),
                  std::move(opt_alternative_peers),
                  std::move(irohad_log_manager),
                  opt_mst_gossip_params,
@@ -42,7 +42,9 @@ namespace fuzzing {
               std::shared_ptr<iroha::ametsuchi::BlockQuery>(storage_))));
       EXPECT_CALL(*storage_, getBlock(_)).WillRepeatedly(Invoke([](auto) {
         return iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(TestBlockBuilder().build()));
+            std::shared_ptr<const shared_model::interface::Block>(
+                clone<shared_model::interface::Block>(
+                    TestBlockBuilder().build())));
       }));
     }
   };
@@ -67,6 +67,8 @@ namespace fuzzing {
       mst_transport_grpc_ = std::make_shared<MstTransportGrpc>(
           async_call_,
           std::move(tx_factory),
+          std::make_shared<shared_model::interface::ParallelTransportBuilder>(
+              1),
           std::move(parser),
           std::move(batch_factory),
           std::move(cache),
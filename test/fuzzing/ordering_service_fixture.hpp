@@ -31,6 +31,8 @@ namespace fuzzing {
   struct OrderingServiceFixture {
     std::shared_ptr<OnDemandOsServerGrpc::TransportFactoryType>
         transaction_factory_;
+    std::shared_ptr<shared_model::interface::ParallelTransportBuilder>
+        transaction_builder_;
     std::shared_ptr<shared_model::interface::TransactionBatchParser>
         batch_parser_;
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
@@ -55,6 +57,10 @@ namespace fuzzing {
               std::move(interface_transaction_validator),
               std::move(proto_transaction_validator));
 
+      transaction_builder_ =
+          std::make_shared<shared_model::interface::ParallelTransportBuilder>(
+              1);
+
       batch_parser_ = std::make_shared<
           shared_model::interface::TransactionBatchParserImpl>();
       std::shared_ptr<shared_model::validation::AbstractValidator<
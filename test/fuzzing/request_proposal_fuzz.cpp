@@ -11,6 +11,7 @@
 #include "logger/dummy_logger.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
+#include "ordering/impl/batches_packing_policies.hpp"
 
 struct RequestProposalFixture : public fuzzing::OrderingServiceFixture {
   std::unique_ptr<shared_model::proto::ProtoProposalFactory<
@@ -41,10 +42,12 @@ struct RequestProposalFixture : public fuzzing::OrderingServiceFixture {
         std::move(proposal_factory_),
         std::move(persistent_cache_),
         proposal_creation_strategy_,
+        std::make_shared<FifoPackingPolicy>(),
         logger::getDummyLoggerPtr());
     server_ =
         std::make_shared<OnDemandOsServerGrpc>(ordering_service_,
                                                transaction_factory_,
+                                               transaction_builder_,
                                                batch_parser_,
                                                transaction_batch_factory_,
                                                logger::getDummyLoggerPtr());
@@ -11,6 +11,7 @@
 #include "logger/dummy_logger.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
 #include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
+#include "ordering/impl/batches_packing_policies.hpp"
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
   static fuzzing::OrderingServiceFixture fixture;
@@ -35,10 +36,12 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, std::size_t size) {
       std::move(proposal_factory),
       std::move(cache),
       proposal_creation_strategy,
+      std::make_shared<FifoPackingPolicy>(),
       logger::getDummyLoggerPtr());
   server_ =
       std::make_shared<OnDemandOsServerGrpc>(ordering_service_,
                                              fixture.transaction_factory_,
+                                             fixture.transaction_builder_,
                                              fixture.batch_parser_,
                                              fixture.transaction_batch_factory_,
                                              logger::getDummyLoggerPtr());
@@ -12,6 +12,7 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/dummy_logger.hpp"
@@ -132,6 +133,8 @@ struct CommandFixture {
             status_bus,
             status_factory,
             transaction_factory,
+            std::make_shared<shared_model::interface::ParallelTransportBuilder>(
+                1),
             batch_parser,
             transaction_batch_factory,
             rxcpp::observable<>::iterate(consensus_gate_objects_),
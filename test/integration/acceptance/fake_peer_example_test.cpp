@@ -111,7 +111,7 @@ TEST_F(FakePeerFixture, SynchronizeTheRightVersionOfForkedLedger) {
   for (decltype(top_height) i = 1; i <= top_height; ++i) {
     auto block_result = block_query->getBlock(i);
 
-    std::shared_ptr<shared_model::interface::Block> block =
+    std::shared_ptr<const shared_model::interface::Block> block =
         boost::get<decltype(block_result)::ValueType>(std::move(block_result))
             .value;
     valid_block_storage->storeBlock(
@@ -84,12 +84,14 @@ namespace {
             perm_converter,
         logger::LoggerPtr log)
         : SessionHolder(std::move(session)),
-          PostgresSpecificQueryExecutor(*SessionHolder::session,
-                                        *block_storage,
-                                        std::move(pending_txs_storage),
-                                        std::move(response_factory),
-                                        std::move(perm_converter),
-                                        std::move(log)),
+          PostgresSpecificQueryExecutor(
+              *SessionHolder::session,
+              std::make_shared<PreparedStatements>(),
+              *block_storage,
+              std::move(pending_txs_storage),
+              std::move(response_factory),
+              std::move(perm_converter),
+              std::move(log)),
           block_storage_(std::move(block_storage)) {}
 
    private:
@@ -236,6 +236,23 @@ TEST_P(GetAccountAssetsBasicTest, NonexistentStartTx) {
       response, error_codes::kInvalidPagination);
 }
 
+/**
+ * @given account with all related permissions and 12 assets
+ * @when queried assets pages of sizes 9 and 10, and then with no page
+ * metadata, with the same executor
+ * @then each response has its own page size. The page size is bound as a
+ * string, so it must be compared as a number, where "10" is not less than "9"
+ */
+TEST_P(GetAccountAssetsBasicTest, PageSizeReboundBetweenQueries) {
+  ASSERT_NO_FATAL_FAILURE(prepareState(12));
+  queryPageAndValidateResponse(boost::none, 9);
+  queryPageAndValidateResponse(boost::none, 10);
+  QueryExecutorResult response = getItf().executeQuery(
+      *getItf().getMockQueryFactory()->constructGetAccountAssets(kUserId,
+                                                                 boost::none));
+  validatePageResponse(response, boost::none, 12);
+}
+
 INSTANTIATE_TEST_CASE_P(Base,
                         GetAccountAssetsBasicTest,
                         executor_testing::getExecutorTestParams(),
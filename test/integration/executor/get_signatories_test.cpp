@@ -86,6 +86,29 @@ TEST_P(GetSignatoriesBasicTest, InvalidNoAccount) {
       error_codes::kNoStatefulError);
 }
 
+/**
+ * @given a user with signatories and a spectator with no permissions
+ * @when GetSignatories is queried by the admin, the spectator and the admin
+ * again with the same executor
+ * @then the issuer, which is bound to several places of the permission check,
+ * is rebound for each query, so only the spectator gets an error
+ */
+TEST_P(GetSignatoriesBasicTest, IssuerReboundBetweenQueries) {
+  ASSERT_NO_FATAL_FAILURE(prepareState(2));
+  assertResultValue(getItf().createUserWithPerms(
+      kSecondUser, kSecondDomain, kSecondDomainUserKeypair.publicKey(), {}));
+
+  auto check_success = [this](const auto &response) {
+    checkSuccessfulResult<SignatoriesResponse>(
+        response,
+        [this](const auto &response) { this->validateResponse(response); });
+  };
+  check_success(query(kAdminId));
+  checkQueryError<shared_model::interface::StatefulFailedErrorResponse>(
+      query(kSecondDomainUserId), error_codes::kNoPermissions);
+  check_success(query(kAdminId));
+}
+
 INSTANTIATE_TEST_CASE_P(Base,
                         GetSignatoriesBasicTest,
                         executor_testing::getExecutorTestParams(),
@@ -6,9 +6,11 @@
 #include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
 
 #include <gtest/gtest.h>
+#include <rxcpp/rx-lite.hpp>
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_checkpoints.hpp"
 #include "ametsuchi/impl/wsv_restorer_impl.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
@@ -85,7 +87,7 @@ TEST_F(AmetsuchiTest, GetBlocksCompletedWhenCalled) {
   apply(storage, block);
 
   ASSERT_EQ(*boost::get<iroha::expected::Value<
-                 std::unique_ptr<shared_model::interface::Block>>>(
+                 std::shared_ptr<const shared_model::interface::Block>>>(
                  blocks->getBlock(1))
                  .value,
             *block);
@@ -140,7 +142,7 @@ TEST_F(AmetsuchiTest, SampleTest) {
   for (size_t i = 0; i < hashes.size(); i++) {
     EXPECT_EQ(*(hashes.begin() + i),
               boost::get<iroha::expected::Value<
-                  std::unique_ptr<shared_model::interface::Block>>>(
+                  std::shared_ptr<const shared_model::interface::Block>>>(
                   blocks->getBlock(i + 1))
                   .value->hash());
   }
@@ -393,6 +395,53 @@ TEST_F(AmetsuchiTest, TestingStorageWhenCommitBlock) {
   wrapper.unsubscribe();
 }
 
+/**
+ * @given storage with a committed block
+ * @when a block is rejected by the predicate of mutable storage
+ * AND another block is applied and committed
+ * @then transactions of the rejected block are not indexed
+ * AND transactions of the committed block are
+ */
+TEST_F(AmetsuchiTest, RejectedBlockIndexIsDiscarded) {
+  auto block1 = getBlock();
+  apply(storage, block1);
+
+  auto rejected_tx = TestTransactionBuilder()
+                         .creatorAccountId("adminone")
+                         .createRole("rejected", {Role::kGetMyAccount})
+                         .build();
+  auto committed_tx = TestTransactionBuilder()
+                          .creatorAccountId("adminone")
+                          .createRole("committed", {Role::kGetMyAccount})
+                          .build();
+  std::shared_ptr<shared_model::interface::Block> rejected_block =
+      clone(TestBlockBuilder()
+                .transactions(
+                    std::vector<shared_model::proto::Transaction>{rejected_tx})
+                .height(2)
+                .prevHash(block1->hash())
+                .createdTime(iroha::time::now())
+                .build());
+  auto committed_block = createBlock({committed_tx}, 2, block1->hash());
+
+  auto mutable_storage = createMutableStorage();
+  ASSERT_FALSE(mutable_storage->apply(
+      rxcpp::observable<>::just(rejected_block),
+      [](const auto &, const auto &) { return false; }));
+  ASSERT_TRUE(mutable_storage->apply(committed_block));
+  ASSERT_TRUE(val(storage->commit(std::move(mutable_storage))));
+
+  auto blocks = storage->getBlockQuery();
+  auto rejected_status = blocks->checkTxPresence(rejected_tx.hash());
+  ASSERT_TRUE(rejected_status);
+  EXPECT_NO_THROW(
+      boost::get<tx_cache_status_responses::Missing>(*rejected_status));
+  auto committed_status = blocks->checkTxPresence(committed_tx.hash());
+  ASSERT_TRUE(committed_status);
+  EXPECT_NO_THROW(
+      boost::get<tx_cache_status_responses::Committed>(*committed_status));
+}
+
 /**
  * @given spoiled WSV
  * @when WSV is restored
@@ -438,7 +487,7 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_FALSE(res);
 
   // recover storage and check it is recovered
-  WsvRestorerImpl wsvRestorer;
+  WsvRestorerImpl wsvRestorer(getTestLogger("WsvRestorer"));
   wsvRestorer.restoreWsv(*storage).match(
       [](const auto &) {},
       [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
@@ -447,6 +496,55 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_TRUE(res);
 }
 
+/**
+ * @given storage with a block and a WSV checkpoint created after it
+ *        @and a domain inserted to WSV bypassing blocks before the checkpoint
+ *        @and one more block applied after the checkpoint
+ * @when WSV is restored using the checkpoint
+ * @then the checkpoint is loaded and only the last block is applied
+ */
+TEST_F(AmetsuchiTest, TestRestoreWsvFromCheckpoint) {
+  auto checkpoints_path = (boost::filesystem::temp_directory_path()
+                           / boost::filesystem::unique_path())
+                              .string();
+  auto checkpoints = std::make_shared<WsvCheckpoints>(
+      checkpoints_path, pgopt_, getTestLogger("WsvCheckpoints"));
+
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("admin@test")
+                    .createRole("user", {Role::kCreateDomain})
+                    .createDomain("first", "user")
+                    .build());
+  auto block1 = createBlock(txs, 1, fake_hash);
+  apply(storage, block1);
+
+  // present only in the checkpoint, so it is lost if block 1 is replayed
+  *sql << "INSERT INTO domain (domain_id, default_role) "
+          "VALUES ('checkpoint', 'user')";
+  auto checkpoint = checkpoints->create();
+  ASSERT_TRUE(val(checkpoint)) << err(checkpoint)->error;
+  EXPECT_EQ(val(checkpoint)->value.height, 1);
+
+  txs.clear();
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("admin@test")
+                    .createDomain("second", "user")
+                    .build());
+  auto block2 = createBlock(txs, 2, block1->hash());
+  apply(storage, block2);
+
+  WsvRestorerImpl wsv_restorer(getTestLogger("WsvRestorer"), checkpoints);
+  auto result = wsv_restorer.restoreWsv(*storage);
+  ASSERT_TRUE(val(result)) << err(result)->error;
+
+  EXPECT_TRUE(sql_query->getDomain("first"));
+  EXPECT_TRUE(sql_query->getDomain("checkpoint"));
+  EXPECT_TRUE(sql_query->getDomain("second"));
+
+  boost::filesystem::remove_all(checkpoints_path);
+}
+
 /**
  * @given created storage
  *        @and a subscribed observer on on_commit() event
@@ -541,7 +639,8 @@ class PreparedBlockTest : public AmetsuchiTest {
                                Role::kAddAssetQty,
                                Role::kAddPeer,
                                Role::kReceive,
-                               Role::kTransfer})
+                               Role::kTransfer,
+                               Role::kAddMySignatory})
                   .createDomain(default_domain, default_role)
                   .createAccount("admin", "test", key.publicKey())
                   .createAsset("coin", default_domain, 2)
@@ -676,3 +775,109 @@ TEST_F(PreparedBlockTest, TemporaryWsvUnlocks) {
   ASSERT_TRUE(val(result));
   storage->prepareBlock(std::move(temp_wsv));
 }
+
+/**
+ * @given TemporaryWsv where an account is created inside a savepoint
+ * @when a transaction of the new account is applied
+ * AND the savepoint is rolled back
+ * AND another transaction of the new account is applied
+ * @then the first transaction passes signatures validation
+ * AND the second one fails it, since the account no longer exists
+ */
+TEST_F(PreparedBlockTest, SignatoriesRolledBackWithSavepoint) {
+  auto user_key =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto create_user = shared_model::proto::TransactionBuilder()
+                         .creatorAccountId("admin@test")
+                         .createdTime(iroha::time::now())
+                         .quorum(1)
+                         .createAccount("user", "test", user_key.publicKey())
+                         .build()
+                         .signAndAddSignature(key)
+                         .finish();
+  auto user_tx = [&user_key](const std::string &amount) {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId("user@test")
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .addAssetQuantity("coin#test", amount)
+        .build()
+        .signAndAddSignature(user_key)
+        .finish();
+  };
+
+  auto savepoint = temp_wsv->createSavepoint("create_user");
+  ASSERT_TRUE(val(temp_wsv->apply(create_user)));
+  ASSERT_TRUE(val(temp_wsv->apply(user_tx("1.00"))));
+  savepoint.reset();
+
+  auto result = temp_wsv->apply(user_tx("2.00"));
+  ASSERT_TRUE(err(result));
+  EXPECT_EQ("signatures validation", err(result)->error.name);
+}
+
+/**
+ * @given committed account user@test which granted admin@test to add its
+ * signatories @and TemporaryWsv where nothing of user@test is loaded yet
+ * @when admin@test adds a new signatory to user@test inside a savepoint
+ * AND a transaction of user@test signed with the new key is applied
+ * AND the savepoint is rolled back
+ * AND another transaction of user@test signed with the new key is applied
+ * @then the first transaction passes signatures validation
+ * AND the second one fails it, since the signatory was rolled back
+ */
+TEST_F(PreparedBlockTest, AddedSignatoryRolledBackWithSavepoint) {
+  auto user_key =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto new_key =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  auto create_user = shared_model::proto::TransactionBuilder()
+                         .creatorAccountId("admin@test")
+                         .createdTime(iroha::time::now())
+                         .quorum(1)
+                         .createAccount("user", "test", user_key.publicKey())
+                         .build()
+                         .signAndAddSignature(key)
+                         .finish();
+  auto grant_admin =
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("user@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .grantPermission("admin@test", Grantable::kAddMySignatory)
+          .build()
+          .signAndAddSignature(user_key)
+          .finish();
+  temp_wsv.reset();
+  apply(storage,
+        createBlock({create_user, grant_admin}, 2, genesis_block->hash()));
+  temp_wsv = storage->createTemporaryWsv(command_executor);
+
+  auto add_signatory = shared_model::proto::TransactionBuilder()
+                           .creatorAccountId("admin@test")
+                           .createdTime(iroha::time::now())
+                           .quorum(1)
+                           .addSignatory("user@test", new_key.publicKey())
+                           .build()
+                           .signAndAddSignature(key)
+                           .finish();
+  auto user_tx = [&new_key](const std::string &amount) {
+    return shared_model::proto::TransactionBuilder()
+        .creatorAccountId("user@test")
+        .createdTime(iroha::time::now())
+        .quorum(1)
+        .addAssetQuantity("coin#test", amount)
+        .build()
+        .signAndAddSignature(new_key)
+        .finish();
+  };
+
+  auto savepoint = temp_wsv->createSavepoint("add_signatory");
+  ASSERT_TRUE(val(temp_wsv->apply(add_signatory)));
+  ASSERT_TRUE(val(temp_wsv->apply(user_tx("1.00"))));
+  savepoint.reset();
+
+  auto result = temp_wsv->apply(user_tx("2.00"));
+  ASSERT_TRUE(err(result));
+  EXPECT_EQ("signatures validation", err(result)->error.name);
+}
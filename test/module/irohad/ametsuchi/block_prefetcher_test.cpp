@@ -0,0 +1,147 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_prefetcher.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "framework/result_fixture.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+using framework::expected::err;
+using framework::expected::val;
+using shared_model::interface::types::HeightType;
+
+static const HeightType kBlocks = 20;
+/// wait for reads which must happen, long enough for a loaded machine
+static const std::chrono::milliseconds kReadTimeout = 10s;
+/// wait for reads which must not happen
+static const std::chrono::milliseconds kNoReadTimeout = 50ms;
+
+/// Block query which counts reads and runs a given callback on each one
+class FakeBlockQuery : public BlockQuery {
+ public:
+  explicit FakeBlockQuery(std::function<BlockResult(HeightType)> get_block)
+      : get_block_(std::move(get_block)) {}
+
+  BlockResult getBlock(HeightType height) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++reads;
+    }
+    read_.notify_all();
+    return get_block_(height);
+  }
+
+  /**
+   * Wait until the given number of blocks is read
+   * @return false if fewer blocks were read within the timeout
+   */
+  bool waitForReads(size_t count, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return read_.wait_for(lock, timeout, [&] { return reads >= count; });
+  }
+
+  boost::optional<TxCacheStatusType> checkTxPresence(
+      const shared_model::crypto::Hash &) override {
+    return boost::none;
+  }
+
+  HeightType getTopBlockHeight() override {
+    return 0;
+  }
+
+  std::atomic<size_t> reads{0};
+
+ private:
+  std::function<BlockResult(HeightType)> get_block_;
+  std::mutex mutex_;
+  std::condition_variable read_;
+};
+
+class BlockPrefetcherTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (HeightType i = 1; i <= kBlocks; ++i) {
+      blocks_.push_back(std::make_shared<MockBlock>());
+    }
+  }
+
+  BlockQuery::BlockResult block(HeightType height) const {
+    return std::shared_ptr<const shared_model::interface::Block>(
+        blocks_.at(height - 1));
+  }
+
+ protected:
+  std::vector<std::shared_ptr<MockBlock>> blocks_;
+};
+
+/**
+ * @given block query which returns later blocks faster
+ * @when blocks are read on several threads
+ * @then they are returned in height order
+ */
+TEST_F(BlockPrefetcherTest, BlocksAreReturnedInOrder) {
+  FakeBlockQuery block_query([this](auto height) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(kBlocks - height));
+    return this->block(height);
+  });
+
+  BlockPrefetcher prefetcher(block_query, 1, kBlocks, 4, 8);
+  for (HeightType i = 1; i <= kBlocks; ++i) {
+    auto block = val(prefetcher.next());
+    ASSERT_TRUE(block) << "block " << i;
+    EXPECT_EQ(block->value, blocks_.at(i - 1));
+  }
+  EXPECT_EQ(kBlocks, block_query.reads);
+}
+
+/**
+ * @given prefetcher with a queue of 3 blocks
+ * @when no block is taken
+ * @then only 3 blocks are read
+ * AND one more block is read after a block is taken
+ */
+TEST_F(BlockPrefetcherTest, ReadAheadIsBounded) {
+  FakeBlockQuery block_query([this](auto height) { return block(height); });
+
+  BlockPrefetcher prefetcher(block_query, 1, kBlocks, 4, 3);
+  ASSERT_TRUE(block_query.waitForReads(3, kReadTimeout));
+  EXPECT_FALSE(block_query.waitForReads(4, kNoReadTimeout));
+  EXPECT_EQ(3, block_query.reads);
+
+  ASSERT_TRUE(val(prefetcher.next()));
+  ASSERT_TRUE(block_query.waitForReads(4, kReadTimeout));
+  EXPECT_FALSE(block_query.waitForReads(5, kNoReadTimeout));
+  EXPECT_EQ(4, block_query.reads);
+}
+
+/**
+ * @given block query which fails to read the second block
+ * @when blocks are taken
+ * @then the error is returned in place of the second block
+ */
+TEST_F(BlockPrefetcherTest, ErrorIsReturnedInPlace) {
+  FakeBlockQuery block_query([this](auto height) -> BlockQuery::BlockResult {
+    if (height == 2) {
+      return iroha::expected::makeError(BlockQuery::GetBlockError{
+          BlockQuery::GetBlockError::Code::kNoBlock, "no block"});
+    }
+    return block(height);
+  });
+
+  BlockPrefetcher prefetcher(block_query, 1, kBlocks);
+  EXPECT_TRUE(val(prefetcher.next()));
+  auto second = err(prefetcher.next());
+  ASSERT_TRUE(second);
+  EXPECT_EQ("no block", second->error.message);
+}
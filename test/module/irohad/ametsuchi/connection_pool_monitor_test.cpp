@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/connection_pool_monitor.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+class ConnectionPoolMonitorTest : public ::testing::Test {
+ protected:
+  ConnectionPoolMonitor monitor_{2, 50ms, getTestLogger("QueryPool")};
+};
+
+/**
+ * @given pool with 2 connections
+ * @when 3 connections are leased at once
+ * @then the third lease fails after the timeout
+ * AND metrics count the leases and the timeout
+ */
+TEST_F(ConnectionPoolMonitorTest, LeaseFailsWhenPoolIsExhausted) {
+  auto first = monitor_.acquire();
+  auto second = monitor_.acquire();
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  ASSERT_FALSE(monitor_.acquire());
+
+  auto metrics = monitor_.metrics();
+  EXPECT_EQ(2, metrics.size);
+  EXPECT_EQ(2, metrics.in_use);
+  EXPECT_EQ(2, metrics.leases);
+  EXPECT_EQ(1, metrics.timeouts);
+  EXPECT_GE(metrics.max_wait, 50ms);
+}
+
+/**
+ * @given pool with all connections leased
+ * @when one of the leases is released while another caller waits
+ * @then the waiting caller gets the connection
+ */
+TEST_F(ConnectionPoolMonitorTest, ReleasedLeaseWakesWaiter) {
+  ConnectionPoolMonitor monitor{1, 10s, getTestLogger("QueryPool")};
+  auto lease = monitor.acquire();
+  ASSERT_TRUE(lease);
+
+  std::thread releaser([&lease] {
+    std::this_thread::sleep_for(10ms);
+    lease.reset();
+  });
+  auto next = monitor.acquire();
+  releaser.join();
+
+  ASSERT_TRUE(next);
+  auto metrics = monitor.metrics();
+  EXPECT_EQ(1, metrics.in_use);
+  EXPECT_EQ(2, metrics.leases);
+  EXPECT_EQ(0, metrics.timeouts);
+
+  next.reset();
+  EXPECT_EQ(0, monitor.metrics().in_use);
+}
@@ -19,6 +19,9 @@ namespace iroha {
       MOCK_CONST_METHOD1(get, boost::optional<Bytes>(Identifier));
       MOCK_CONST_METHOD0(directory, std::string(void));
       MOCK_CONST_METHOD0(last_id, Identifier(void));
+      MOCK_CONST_METHOD0(size, size_t(void));
+      MOCK_CONST_METHOD1(forEachId,
+                         void(const std::function<void(Identifier)> &));
       MOCK_METHOD0(dropAll, void(void));
     };
 
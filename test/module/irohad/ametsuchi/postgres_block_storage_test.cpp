@@ -11,6 +11,7 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "common/result.hpp"
 #include "framework/config_helper.hpp"
+#include "framework/result_fixture.hpp"
 #include "framework/result_gtest_checkers.hpp"
 #include "framework/test_logger.hpp"
 #include "generator/generator.hpp"
@@ -209,3 +210,81 @@ TEST_F(PostgresBlockStorageTest, ForEach) {
 
   ASSERT_EQ(2, count);
 }
+
+/**
+ * @given block storage table of previous version with block stored as hex text
+ * @when the table is migrated to binary form
+ * @then the block is fetched both before and after the migration
+ */
+TEST_F(PostgresBlockStorageTest, MigrateFromHexText) {
+  auto tx = TestTransactionBuilder().creatorAccountId(creator_).build();
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(std::move(tx));
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+
+  const std::string legacy_table = "legacy_blocks";
+  auto hex_data = block.blob().hex();
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  sql << "CREATE TABLE " << legacy_table
+      << "(height bigint PRIMARY KEY, block_data text not null)";
+  sql << "INSERT INTO " << legacy_table
+      << " (height, block_data) VALUES(:height, :block_data)",
+      soci::use(height_), soci::use(hex_data);
+
+  auto fetch = [&](PostgresBlockStorage::BlockDataFormat format) {
+    return PostgresBlockStorage(pool_wrapper_,
+                                block_factory_,
+                                legacy_table,
+                                format,
+                                getTestLogger("PostgresBlockStorage"))
+        .fetch(height_);
+  };
+
+  ASSERT_EQ(PostgresBlockStorage::BlockDataFormat::kHexText,
+            framework::expected::val(
+                PostgresBlockStorageFactory::getBlockDataFormat(
+                    sql, legacy_table))
+                ->value);
+  auto hex_block = fetch(PostgresBlockStorage::BlockDataFormat::kHexText);
+  ASSERT_TRUE(hex_block);
+  ASSERT_EQ(block.blob(), (*hex_block)->blob());
+
+  framework::expected::assertResultValue(
+      PostgresBlockStorageFactory::migrateToBinary(sql, legacy_table));
+
+  ASSERT_EQ(PostgresBlockStorage::BlockDataFormat::kBinary,
+            framework::expected::val(
+                PostgresBlockStorageFactory::getBlockDataFormat(
+                    sql, legacy_table))
+                ->value);
+  auto binary_block = fetch(PostgresBlockStorage::BlockDataFormat::kBinary);
+  ASSERT_TRUE(binary_block);
+  ASSERT_EQ(block.blob(), (*binary_block)->blob());
+}
+
+/**
+ * @given block storage with two blocks inserted
+ * @when another storage is created over the same table
+ * @then it reports the stored blocks
+ * AND accepts only the block following the last stored one
+ */
+TEST_F(PostgresBlockStorageTest, HeightRangeRestored) {
+  ON_CALL(*mock_other_block_, height()).WillByDefault(Return(height_ + 1));
+  ASSERT_TRUE(block_storage_->insert(mock_block_));
+  ASSERT_TRUE(block_storage_->insert(mock_other_block_));
+
+  PostgresBlockStorage reopened_storage(
+      pool_wrapper_,
+      block_factory_,
+      test_table_,
+      PostgresBlockStorage::BlockDataFormat::kBinary,
+      getTestLogger("PostgresBlockStorage"));
+
+  ASSERT_EQ(2, reopened_storage.size());
+  ASSERT_FALSE(reopened_storage.insert(mock_other_block_));
+  auto next_block = std::make_shared<NiceMock<MockBlock>>();
+  ON_CALL(*next_block, height()).WillByDefault(Return(height_ + 2));
+  ON_CALL(*next_block, blob()).WillByDefault(ReturnRef(blob_));
+  ASSERT_TRUE(reopened_storage.insert(next_block));
+  ASSERT_EQ(3, reopened_storage.size());
+}
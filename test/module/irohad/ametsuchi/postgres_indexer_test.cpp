@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_indexer.hpp"
+
+#include <gtest/gtest.h>
+#include "ametsuchi/block_query.hpp"
+#include "cryptography/hash.hpp"
+#include "framework/result_fixture.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+
+using namespace iroha::ametsuchi;
+using framework::expected::val;
+
+class PostgresIndexerTest : public AmetsuchiTest {
+ protected:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+    indexer = std::make_unique<PostgresIndexer>(*sql);
+  }
+
+  /// @return number of rows in the table
+  long long count(const std::string &table) {
+    long long result = 0;
+    *sql << "SELECT count(*) FROM " + table, soci::into(result);
+    return result;
+  }
+
+  const std::string creator{"cre\tat\\or@do\nmain"};
+  const std::string account{"acc\\ount@do\tmain"};
+  const std::string asset{"co\nin#do\\main"};
+  const shared_model::crypto::Hash hash{std::string{"h\ta\\s\nh"}};
+  std::unique_ptr<PostgresIndexer> indexer;
+};
+
+/**
+ * @given indexer with values containing characters escaped by COPY
+ * @when the indexes are flushed
+ * @then the values are read back from the index tables unchanged
+ */
+TEST_F(PostgresIndexerTest, EscapedValuesAreReadBack) {
+  indexer->txHashPosition(hash, {1, 2});
+  indexer->committedTxHash(hash);
+  indexer->txPositionByCreator(creator, {1, 2});
+  indexer->accountAssetTxPosition(account, asset, {1, 2});
+  ASSERT_TRUE(val(indexer->flush()));
+
+  std::string creator_id;
+  *sql << "SELECT creator_id FROM tx_position_by_creator "
+          "WHERE height = 1 AND index = 2",
+      soci::into(creator_id);
+  EXPECT_EQ(creator, creator_id);
+
+  std::string account_id, asset_id;
+  *sql << "SELECT account_id, asset_id FROM position_by_account_asset "
+          "WHERE height = 1 AND index = 2",
+      soci::into(account_id), soci::into(asset_id);
+  EXPECT_EQ(account, account_id);
+  EXPECT_EQ(asset, asset_id);
+
+  long long index = 0;
+  const auto hash_hex = hash.hex();
+  *sql << "SELECT index FROM position_by_hash WHERE hash = :hash",
+      soci::into(index), soci::use(hash_hex);
+  EXPECT_EQ(2, index);
+
+  auto status = storage->getBlockQuery()->checkTxPresence(hash);
+  ASSERT_TRUE(status);
+  EXPECT_NO_THROW(boost::get<tx_cache_status_responses::Committed>(*status));
+}
+
+/**
+ * @given indexer which has flushed its indexes
+ * @when it is flushed again
+ * @then no rows are inserted by the second flush
+ */
+TEST_F(PostgresIndexerTest, SecondFlushInsertsNothing) {
+  indexer->txHashPosition(hash, {1, 0});
+  indexer->rejectedTxHash(hash);
+  indexer->txPositionByCreator(creator, {1, 0});
+  indexer->accountAssetTxPosition(account, asset, {1, 0});
+  ASSERT_TRUE(val(indexer->flush()));
+  ASSERT_TRUE(val(indexer->flush()));
+
+  for (auto table : {"position_by_hash",
+                     "tx_status_by_hash",
+                     "tx_position_by_creator",
+                     "position_by_account_asset"}) {
+    EXPECT_EQ(1, count(table)) << table;
+  }
+}
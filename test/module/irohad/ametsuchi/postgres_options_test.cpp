@@ -164,3 +164,59 @@ TEST(PostgresOptionsTest, SeparateParams) {
               default_working_dbname,
               "maintenance_dbname");
 }
+
+/**
+ * @given PostgresOptions initialized with a replica
+ * @when replica connection strings are requested
+ * @then they use the host and port of the replica
+ * AND the credentials and database names of the primary
+ * AND the primary connection strings are not affected
+ */
+TEST(PostgresOptionsTest, Replica) {
+  auto pg_opt = PostgresOptions("down",
+                                1991,
+                                "whales",
+                                "donald",
+                                default_working_dbname,
+                                "maintenance_dbname",
+                                test_log,
+                                PostgresOptions::Replica{"up", 1992});
+  checkPgOpts(pg_opt,
+              "down",
+              "1991",
+              "whales",
+              "donald",
+              default_working_dbname,
+              "maintenance_dbname");
+  ASSERT_TRUE(pg_opt.replicaConnectionString());
+  checkConnString(*pg_opt.replicaConnectionString(),
+                  "up",
+                  "1992",
+                  "whales",
+                  "donald",
+                  default_working_dbname);
+  ASSERT_TRUE(pg_opt.replicaMaintenanceConnectionString());
+  checkConnString(*pg_opt.replicaMaintenanceConnectionString(),
+                  "up",
+                  "1992",
+                  "whales",
+                  "donald",
+                  "maintenance_dbname");
+}
+
+/**
+ * @given PostgresOptions initialized without a replica
+ * @when replica connection strings are requested
+ * @then there are none
+ */
+TEST(PostgresOptionsTest, NoReplica) {
+  auto pg_opt = PostgresOptions("down",
+                                1991,
+                                "whales",
+                                "donald",
+                                default_working_dbname,
+                                "maintenance_dbname",
+                                test_log);
+  ASSERT_FALSE(pg_opt.replicaConnectionString());
+  ASSERT_FALSE(pg_opt.replicaMaintenanceConnectionString());
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/replica_watermark.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+
+class ReplicaWatermarkTest : public ::testing::Test {
+ protected:
+  /// Getter of the replica height which counts its calls
+  ReplicaWatermark::HeightGetter getter() {
+    return [this]() -> boost::optional<ReplicaWatermark::HeightType> {
+      ++fetches_;
+      return replica_height_;
+    };
+  }
+
+  boost::optional<ReplicaWatermark::HeightType> replica_height_;
+  size_t fetches_ = 0;
+};
+
+/**
+ * @given empty ledger
+ * @when the replica is checked
+ * @then it is caught up without fetching its height
+ */
+TEST_F(ReplicaWatermarkTest, EmptyLedgerIsCaughtUp) {
+  ReplicaWatermark watermark{1h};
+  EXPECT_TRUE(watermark.caughtUp(0, getter()));
+  EXPECT_EQ(0, fetches_);
+}
+
+/**
+ * @given replica at height 5
+ * @when it is checked against committed heights 4, 5 and 6
+ * @then it is caught up with 4 and 5, and behind 6
+ */
+TEST_F(ReplicaWatermarkTest, ComparesWithCommittedHeight) {
+  ReplicaWatermark watermark{0ms};
+  replica_height_ = 5;
+  EXPECT_TRUE(watermark.caughtUp(4, getter()));
+  EXPECT_TRUE(watermark.caughtUp(5, getter()));
+  EXPECT_FALSE(watermark.caughtUp(6, getter()));
+}
+
+/**
+ * @given replica with unknown height
+ * @when it is checked
+ * @then it is behind
+ */
+TEST_F(ReplicaWatermarkTest, UnknownHeightIsBehind) {
+  ReplicaWatermark watermark{0ms};
+  EXPECT_FALSE(watermark.caughtUp(1, getter()));
+  EXPECT_EQ(1, fetches_);
+}
+
+/**
+ * @given replica behind the ledger, checked once
+ * @when it catches up and is checked again within the time to live
+ * @then the cached height is used, so the replica is still behind
+ */
+TEST_F(ReplicaWatermarkTest, HeightIsCachedWithinTtl) {
+  ReplicaWatermark watermark{1h};
+  replica_height_ = 1;
+  EXPECT_FALSE(watermark.caughtUp(2, getter()));
+
+  replica_height_ = 2;
+  EXPECT_FALSE(watermark.caughtUp(2, getter()));
+  EXPECT_EQ(1, fetches_);
+}
+
+/**
+ * @given replica behind the ledger, checked once
+ * @when it catches up and is checked again after the time to live
+ * @then the height is fetched again and the replica is caught up
+ */
+TEST_F(ReplicaWatermarkTest, HeightIsFetchedAfterTtl) {
+  ReplicaWatermark watermark{0ms};
+  replica_height_ = 1;
+  EXPECT_FALSE(watermark.caughtUp(2, getter()));
+
+  replica_height_ = 2;
+  EXPECT_TRUE(watermark.caughtUp(2, getter()));
+  EXPECT_EQ(2, fetches_);
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log_block_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace shared_model::validation;
+namespace fs = boost::filesystem;
+
+using MockBlockIValidator = MockValidator<shared_model::interface::Block>;
+using MockBlockPValidator = MockValidator<iroha::protocol::Block>;
+
+class SegmentedLogBlockStorageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path_);
+    auto segmented_log =
+        SegmentedLog::create(block_store_path_,
+                             1,
+                             SegmentedLog::kDefaultSegmentSize,
+                             getTestLogger("SegmentedLog"));
+    ASSERT_TRUE(segmented_log);
+    block_storage_ = std::make_unique<SegmentedLogBlockStorage>(
+        std::move(*segmented_log),
+        std::make_shared<shared_model::proto::ProtoBlockFactory>(
+            std::make_unique<MockBlockIValidator>(),
+            std::make_unique<MockBlockPValidator>()),
+        getTestLogger("SegmentedLogBlockStorage"));
+  }
+
+  void TearDown() override {
+    block_storage_ = nullptr;
+    fs::remove_all(block_store_path_);
+  }
+
+  shared_model::proto::Block makeBlock(
+      shared_model::interface::types::HeightType height) {
+    std::vector<shared_model::proto::Transaction> txs;
+    txs.push_back(TestTransactionBuilder().creatorAccountId(creator_).build());
+    return TestBlockBuilder().height(height).transactions(txs).build();
+  }
+
+  std::string creator_ = "user1@test";
+  std::string block_store_path_ =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::unique_ptr<BlockStorage> block_storage_;
+};
+
+/**
+ * @given block storage with two blocks inserted
+ * @when blocks are fetched
+ * @then they are parsed from the memory mapped segment
+ * AND match the inserted ones
+ */
+TEST_F(SegmentedLogBlockStorageTest, FetchExisting) {
+  auto block1 = makeBlock(1);
+  auto block2 = makeBlock(2);
+  ASSERT_TRUE(block_storage_->insert(clone(block1)));
+  ASSERT_TRUE(block_storage_->insert(clone(block2)));
+
+  ASSERT_EQ(2, block_storage_->size());
+  auto fetched1 = block_storage_->fetch(1);
+  auto fetched2 = block_storage_->fetch(2);
+  ASSERT_TRUE(fetched1);
+  ASSERT_TRUE(fetched2);
+  ASSERT_EQ(block1.blob(), (*fetched1)->blob());
+  ASSERT_EQ(block2.blob(), (*fetched2)->blob());
+}
+
+/**
+ * @given block storage with a block inserted
+ * @when a block with non-sequential height is inserted
+ * AND a missing block is fetched
+ * @then insertion fails AND nothing is returned
+ */
+TEST_F(SegmentedLogBlockStorageTest, NonSequentialAndMissing) {
+  ASSERT_TRUE(block_storage_->insert(clone(makeBlock(1))));
+  ASSERT_FALSE(block_storage_->insert(clone(makeBlock(3))));
+  ASSERT_FALSE(block_storage_->fetch(2));
+}
@@ -0,0 +1,191 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_log/segmented_log.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class SegmentedLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+  }
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  std::unique_ptr<SegmentedLog> createLog(
+      uint64_t segment_size = SegmentedLog::kDefaultSegmentSize) {
+    auto log = SegmentedLog::create(block_store_path, 1, segment_size, log_);
+    EXPECT_TRUE(log);
+    return log ? std::move(*log) : nullptr;
+  }
+
+  /// @return record which differs for each id
+  SegmentedLog::Bytes record(SegmentedLog::Identifier id) {
+    return SegmentedLog::Bytes(100 + id, static_cast<uint8_t>(id));
+  }
+
+  /// @return paths of files with given extension in the storage directory
+  std::vector<fs::path> files(const std::string &extension) {
+    std::vector<fs::path> result;
+    for (auto it = fs::directory_iterator{block_store_path};
+         it != fs::directory_iterator{};
+         ++it) {
+      if (it->path().extension() == extension) {
+        result.push_back(it->path());
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  logger::LoggerPtr log_ = getTestLogger("SegmentedLog");
+};
+
+/**
+ * @given empty storage with small segments
+ * @when a lot of records are added
+ * @then records are split into several segments
+ * AND each record is read back
+ * AND the storage reopened from the same folder reads them too
+ */
+TEST_F(SegmentedLogTest, ReadWriteAcrossSegments) {
+  const SegmentedLog::Identifier kCount = 300;
+  {
+    auto log = createLog(4096);
+    for (SegmentedLog::Identifier id = 1; id <= kCount; ++id) {
+      ASSERT_TRUE(log->add(id, record(id)));
+    }
+    EXPECT_GT(files(SegmentedLog::kSegmentExtension).size(), 1);
+    for (SegmentedLog::Identifier id = 1; id <= kCount; ++id) {
+      ASSERT_EQ(record(id), log->get(id).value_or(SegmentedLog::Bytes{}));
+    }
+  }
+
+  auto log = createLog(4096);
+  ASSERT_EQ(kCount, log->last_id());
+  ASSERT_EQ(kCount, log->size());
+  for (SegmentedLog::Identifier id = 1; id <= kCount; ++id) {
+    ASSERT_EQ(record(id), log->get(id).value_or(SegmentedLog::Bytes{}));
+  }
+  ASSERT_FALSE(log->get(kCount + 1));
+}
+
+/**
+ * @given storage with records
+ * @when a record which does not follow the last one is added
+ * @then insertion fails
+ */
+TEST_F(SegmentedLogTest, NonConsecutiveRejected) {
+  auto log = createLog();
+  ASSERT_TRUE(log->add(5, record(5)));
+  ASSERT_FALSE(log->add(5, record(5)));
+  ASSERT_FALSE(log->add(7, record(7)));
+  ASSERT_TRUE(log->add(6, record(6)));
+
+  std::vector<SegmentedLog::Identifier> ids;
+  log->forEachId([&ids](auto id) { ids.push_back(id); });
+  ASSERT_EQ((std::vector<SegmentedLog::Identifier>{5, 6}), ids);
+}
+
+/**
+ * @given storage with records, last of which is partially written
+ * @when the storage is reopened
+ * @then the incomplete record is dropped
+ * AND it could be added again
+ */
+TEST_F(SegmentedLogTest, TornRecordTruncated) {
+  {
+    auto log = createLog();
+    ASSERT_TRUE(log->add(1, record(1)));
+    ASSERT_TRUE(log->add(2, record(2)));
+  }
+  auto segment = files(SegmentedLog::kSegmentExtension).front();
+  fs::resize_file(segment, fs::file_size(segment) - 10);
+
+  auto log = createLog();
+  ASSERT_EQ(1, log->last_id());
+  ASSERT_TRUE(log->add(2, record(2)));
+  ASSERT_EQ(record(2), log->get(2).value_or(SegmentedLog::Bytes{}));
+}
+
+/**
+ * @given folder with blocks of a flat file store
+ * @when a segmented log is created in it
+ * @then creation fails instead of opening an empty log
+ */
+TEST_F(SegmentedLogTest, ForeignFilesRejected) {
+  fs::ofstream(fs::path(block_store_path) / "0000000000000001") << "{}";
+
+  ASSERT_FALSE(SegmentedLog::create(
+      block_store_path, 1, SegmentedLog::kDefaultSegmentSize, log_));
+}
+
+/**
+ * @given storage with records
+ * @when all records are dropped
+ * @then storage is empty and accepts any identifier
+ */
+TEST_F(SegmentedLogTest, DropAll) {
+  auto log = createLog();
+  ASSERT_TRUE(log->add(1, record(1)));
+  log->dropAll();
+
+  ASSERT_EQ(0, log->size());
+  ASSERT_FALSE(log->get(1));
+  ASSERT_TRUE(log->add(3, record(3)));
+  ASSERT_EQ(3, log->last_id());
+}
+
+/**
+ * @given storage with a record read through memory mapping
+ * @when another record is appended to the same segment
+ * @then the new record is read too
+ * AND the previously read record stays valid
+ */
+TEST_F(SegmentedLogTest, MappedRecordsSurviveGrowth) {
+  auto log = createLog();
+  ASSERT_TRUE(log->add(1, record(1)));
+  auto first = log->getMapped(1);
+  ASSERT_TRUE(first);
+
+  ASSERT_TRUE(log->add(2, record(2)));
+  auto second = log->getMapped(2);
+  ASSERT_TRUE(second);
+
+  ASSERT_EQ(record(1),
+            SegmentedLog::Bytes(first->data, first->data + first->size));
+  ASSERT_EQ(record(2),
+            SegmentedLog::Bytes(second->data, second->data + second->size));
+}
+
+/**
+ * @given storage with a record read through memory mapping
+ * @when more records are appended to the same segment
+ * @then they are read through the same mapping without remapping
+ */
+TEST_F(SegmentedLogTest, AppendedRecordsReadWithoutRemap) {
+  auto log = createLog();
+  ASSERT_TRUE(log->add(1, record(1)));
+  auto first = log->getMapped(1);
+  ASSERT_TRUE(first);
+
+  for (SegmentedLog::Identifier id = 2; id <= 10; ++id) {
+    ASSERT_TRUE(log->add(id, record(id)));
+    auto mapped = log->getMapped(id);
+    ASSERT_TRUE(mapped);
+    ASSERT_EQ(first->mapping, mapped->mapping);
+    ASSERT_EQ(record(id),
+              SegmentedLog::Bytes(mapped->data, mapped->data + mapped->size));
+  }
+}
@@ -0,0 +1,173 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/storage_impl.hpp"
+
+#include <regex>
+
+#include <gtest/gtest.h>
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/connection_pool_monitor.hpp"
+#include "ametsuchi/impl/in_memory_block_storage.hpp"
+#include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "common/result.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "module/irohad/pending_txs_storage/pending_txs_storage_mock.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace iroha::expected;
+using namespace std::chrono_literals;
+
+/**
+ * Storage with a query pool connected to a "replica", which is the working
+ * database itself, so that the test controls the replica height through the
+ * top_block_info table. The ledger has one block.
+ */
+class StorageQueryPoolTest : public ::testing::Test {
+ protected:
+  /// @return value of the field of the test connection string
+  static std::string getField(const std::string &pg_opt,
+                              const std::string &field) {
+    std::smatch match;
+    std::regex_search(pg_opt, match, std::regex(field + "=([^ ]+)"));
+    return match[1];
+  }
+
+  void SetUp() override {
+    auto pg_opt = integration_framework::getPostgresCredsOrDefault();
+    auto host = getField(pg_opt, "host");
+    auto port = static_cast<uint16_t>(std::stoi(getField(pg_opt, "port")));
+    auto user = getField(pg_opt, "user");
+    auto options = std::make_unique<PostgresOptions>(
+        host,
+        port,
+        user,
+        getField(pg_opt, "password"),
+        integration_framework::getRandomDbName(),
+        user,
+        log_manager_->getLogger(),
+        PostgresOptions::Replica{host, port});
+    working_pg_opt_ = options->workingConnectionString();
+
+    PgConnectionInit::createDatabaseIfNotExist(*options).match(
+        [](auto &&) {}, [](auto &&error) { FAIL() << error.error; });
+    auto pool = PgConnectionInit::prepareConnectionPool(
+        KTimesReconnectionStrategyFactory{0},
+        *options,
+        kPoolSize,
+        log_manager_,
+        QueryPoolOptions{1, 100ms});
+    if (auto e = resultToOptionalError(pool)) {
+      FAIL() << e.value();
+    }
+    pool_wrapper_ = resultToOptionalValue(std::move(pool)).value();
+
+    auto block_storage = std::make_unique<InMemoryBlockStorage>();
+    block_storage->insert(createBlock({}, 1));
+
+    StorageImpl::create(
+        std::move(options),
+        pool_wrapper_,
+        std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+        pending_txs_storage_,
+        query_response_factory_,
+        std::make_unique<InMemoryBlockStorageFactory>(),
+        std::move(block_storage),
+        log_manager_)
+        .match([this](const auto &value) { storage_ = value.value; },
+               [](const auto &error) { FAIL() << error.error; });
+  }
+
+  void TearDown() override {
+    if (storage_) {
+      storage_->dropStorage();
+    }
+  }
+
+  /// Set the height of the replica
+  void setReplicaHeight(shared_model::interface::types::HeightType height) {
+    soci::session sql(*soci::factory_postgresql(), working_pg_opt_);
+    sql << "INSERT INTO top_block_info (height, hash) VALUES (:height, '')",
+        soci::use(height);
+  }
+
+  boost::optional<std::shared_ptr<QueryExecutor>> createQueryExecutor() {
+    return storage_->createQueryExecutor(pending_txs_storage_,
+                                         query_response_factory_);
+  }
+
+  static constexpr int kPoolSize = 2;
+
+  logger::LoggerManagerTreePtr log_manager_{
+      getTestLoggerManager()->getChild("Storage")};
+  std::shared_ptr<iroha::MockPendingTransactionStorage> pending_txs_storage_ =
+      std::make_shared<iroha::MockPendingTransactionStorage>();
+  std::shared_ptr<shared_model::interface::QueryResponseFactory>
+      query_response_factory_ =
+          std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
+
+  std::string working_pg_opt_;
+  std::shared_ptr<PoolWrapper> pool_wrapper_;
+  std::shared_ptr<StorageImpl> storage_;
+};
+
+constexpr int StorageQueryPoolTest::kPoolSize;
+
+/**
+ * @given replica with the committed block
+ * @when query executor is created
+ * @then it leases a connection of the replica pool
+ */
+TEST_F(StorageQueryPoolTest, ReplicaServesQueriesWhenCaughtUp) {
+  setReplicaHeight(1);
+
+  auto executor = createQueryExecutor();
+  ASSERT_TRUE(executor);
+
+  EXPECT_EQ(1, pool_wrapper_->query_pool_monitor_->metrics().in_use);
+  EXPECT_EQ(0, pool_wrapper_->primary_query_pool_monitor_->metrics().leases);
+}
+
+/**
+ * @given replica which has not applied the committed block
+ * @when query executor is created
+ * @then it leases a connection of the primary query pool
+ * AND the replica connection is given back
+ */
+TEST_F(StorageQueryPoolTest, PrimaryServesQueriesWhileReplicaLags) {
+  auto executor = createQueryExecutor();
+  ASSERT_TRUE(executor);
+
+  auto replica_metrics = pool_wrapper_->query_pool_monitor_->metrics();
+  EXPECT_EQ(1, replica_metrics.leases);
+  EXPECT_EQ(0, replica_metrics.in_use);
+  EXPECT_EQ(1, pool_wrapper_->primary_query_pool_monitor_->metrics().in_use);
+
+  executor = boost::none;
+  EXPECT_EQ(0, pool_wrapper_->primary_query_pool_monitor_->metrics().in_use);
+}
+
+/**
+ * @given replica which has not applied the committed block
+ * AND the only primary query connection is leased
+ * @when another query executor is created
+ * @then it is not created after the lease timeout
+ * AND the consensus pool is not used instead
+ */
+TEST_F(StorageQueryPoolTest, QueryFailsWhenPrimaryPoolIsExhausted) {
+  auto executor = createQueryExecutor();
+  ASSERT_TRUE(executor);
+
+  EXPECT_FALSE(createQueryExecutor());
+  EXPECT_EQ(1, pool_wrapper_->primary_query_pool_monitor_->metrics().timeouts);
+}
@@ -172,3 +172,29 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
       },
       [&](const auto &error) { FAIL() << error.error; });
 }
+
+/**
+ * @given cache with a filter which contains a committed hash
+ * @when cache asked for statuses of the committed hash and of another one
+ * @then storage is queried only for the committed hash
+ * AND the other hash is Missing
+ */
+TEST_F(TxPresenceCacheTest, FilteredHashIsNotQueried) {
+  shared_model::crypto::Hash committed_hash("1");
+  shared_model::crypto::Hash missing_hash("2");
+  auto filter = std::make_shared<TxPresenceFilter>(100);
+  filter->insert(committed_hash);
+  EXPECT_CALL(*mock_block_query, checkTxPresence(committed_hash))
+      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
+          tx_cache_status_responses::Committed(committed_hash))));
+  EXPECT_CALL(*mock_block_query, checkTxPresence(missing_hash)).Times(0);
+  TxPresenceCacheImpl cache(mock_storage, 100, filter);
+
+  ASSERT_NO_THROW(boost::get<tx_cache_status_responses::Committed>(
+      *cache.check(committed_hash)));
+  tx_cache_status_responses::Missing check_missing_result;
+  ASSERT_NO_THROW(check_missing_result =
+                      boost::get<tx_cache_status_responses::Missing>(
+                          *cache.check(missing_hash)));
+  ASSERT_EQ(missing_hash, check_missing_result.hash);
+}
@@ -0,0 +1,170 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_presence_filter.hpp"
+
+#include <deque>
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/range/adaptor/indirected.hpp>
+#include "framework/result_gtest_checkers.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace testing;
+using shared_model::crypto::Hash;
+
+class TxPresenceFilterTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    path_ = (boost::filesystem::temp_directory_path()
+             / boost::filesystem::unique_path())
+                .string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(path_);
+  }
+
+  /// @return distinct hash for each number
+  static Hash hash(size_t i) {
+    return Hash("tx" + std::to_string(i));
+  }
+
+  /// @return block at the height with a committed and a rejected hash
+  std::shared_ptr<MockBlock> makeBlock(
+      shared_model::interface::types::HeightType height,
+      const Hash &committed,
+      const Hash &rejected) {
+    auto tx = std::make_shared<NiceMock<MockTransaction>>();
+    ON_CALL(*tx, hash()).WillByDefault(ReturnRefOfCopy(committed));
+    txs_.emplace_back(1, tx);
+    rejected_.push_back(rejected);
+
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    ON_CALL(*block, hash())
+        .WillByDefault(
+            ReturnRefOfCopy(Hash("block" + std::to_string(height))));
+    ON_CALL(*block, transactions())
+        .WillByDefault(Return(txs_.back() | boost::adaptors::indirected));
+    ON_CALL(*block, rejected_transactions_hashes())
+        .WillByDefault(Return(
+            boost::make_iterator_range(rejected_.end() - 1, rejected_.end())));
+    return block;
+  }
+
+ protected:
+  std::string path_;
+  std::deque<std::vector<std::shared_ptr<MockTransaction>>> txs_;
+  std::deque<Hash> rejected_;
+};
+
+/**
+ * @given filter with inserted hashes
+ * @when hashes are checked
+ * @then every inserted hash is found
+ * AND few of other hashes are reported
+ */
+TEST_F(TxPresenceFilterTest, InsertedHashesAreFound) {
+  const size_t kHashes = 10000;
+  TxPresenceFilter filter(kHashes);
+  for (size_t i = 0; i < kHashes; ++i) {
+    filter.insert(hash(i));
+  }
+
+  size_t false_positives = 0;
+  for (size_t i = 0; i < kHashes; ++i) {
+    ASSERT_TRUE(filter.mayContain(hash(i)));
+    false_positives += filter.mayContain(hash(kHashes + i));
+  }
+  EXPECT_EQ(kHashes, filter.size());
+  EXPECT_LT(false_positives, kHashes / 50);
+}
+
+/**
+ * @given stored filter
+ * @when it is loaded
+ * @then it contains the same hashes and the last block
+ */
+TEST_F(TxPresenceFilterTest, SaveAndLoad) {
+  TxPresenceFilter filter(100);
+  filter.insert(*makeBlock(3, hash(1), hash(2)));
+  framework::expected::assertResultValue(filter.save(path_));
+
+  auto loaded =
+      iroha::expected::resultToOptionalValue(TxPresenceFilter::load(path_));
+  ASSERT_TRUE(loaded);
+  const auto &value = *loaded;
+  EXPECT_TRUE(value->mayContain(hash(1)));
+  EXPECT_TRUE(value->mayContain(hash(2)));
+  EXPECT_EQ(filter.size(), value->size());
+  EXPECT_EQ(filter.capacity(), value->capacity());
+  EXPECT_EQ(3, value->height());
+}
+
+/**
+ * @given stored filter with a damaged byte
+ * @when it is loaded
+ * @then loading fails
+ */
+TEST_F(TxPresenceFilterTest, CorruptedFileIsNotLoaded) {
+  TxPresenceFilter filter(100);
+  filter.insert(hash(1));
+  framework::expected::assertResultValue(filter.save(path_));
+  {
+    std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(40);
+    file.put(static_cast<char>(0xff));
+  }
+
+  ASSERT_TRUE(iroha::expected::hasError(TxPresenceFilter::load(path_)));
+}
+
+/**
+ * @given empty filter and a ledger of two blocks
+ * @when the filter catches up with the ledger
+ * @then it contains committed and rejected hashes of both blocks
+ */
+TEST_F(TxPresenceFilterTest, CatchUpAddsFollowingBlocks) {
+  MockBlockQuery block_query;
+  std::shared_ptr<const shared_model::interface::Block> blocks[] = {
+      makeBlock(1, hash(1), hash(2)), makeBlock(2, hash(3), hash(4))};
+  EXPECT_CALL(block_query, getTopBlockHeight()).WillOnce(Return(2));
+  for (auto &block : blocks) {
+    EXPECT_CALL(block_query, getBlock(block->height()))
+        .WillOnce(Return(ByMove(iroha::expected::makeValue(block))));
+  }
+
+  TxPresenceFilter filter(100);
+  framework::expected::assertResultValue(filter.catchUp(block_query));
+  for (size_t i = 1; i <= 4; ++i) {
+    EXPECT_TRUE(filter.mayContain(hash(i)));
+  }
+  EXPECT_EQ(2, filter.height());
+}
+
+/**
+ * @given filter whose last block differs from the block of the ledger
+ * @when the filter catches up with the ledger
+ * @then an error is returned
+ */
+TEST_F(TxPresenceFilterTest, CatchUpFailsOnOtherLedger) {
+  TxPresenceFilter filter(100);
+  filter.insert(*makeBlock(1, hash(1), hash(2)));
+
+  MockBlockQuery block_query;
+  auto other_block = makeBlock(1, hash(3), hash(4));
+  ON_CALL(*other_block, hash()).WillByDefault(ReturnRefOfCopy(Hash("other")));
+  EXPECT_CALL(block_query, getBlock(1))
+      .WillOnce(Return(ByMove(iroha::expected::makeValue(
+          std::shared_ptr<const shared_model::interface::Block>(
+              other_block)))));
+
+  framework::expected::assertResultError(filter.catchUp(block_query));
+}
@@ -9,6 +9,7 @@
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "framework/result_fixture.hpp"
 #include "framework/test_logger.hpp"
+#include "main/impl/pg_connection_init.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
 #include "module/shared_model/interface_mocks.hpp"
 
@@ -70,5 +71,42 @@ namespace iroha {
       ASSERT_TRUE(val(command->deletePeer(*peer)));
     }
 
+    /**
+     * @given account with details kept in JSONB column of account table, as
+     * previous versions did
+     * @when tables are prepared
+     * @then the details are moved to account_detail table
+     * AND the column is dropped
+     */
+    TEST_F(WsvQueryCommandTest, AccountDetailsMigrated) {
+      *sql << "INSERT INTO role(role_id) VALUES ('user')";
+      *sql << "INSERT INTO domain(domain_id, default_role) "
+              "VALUES ('domain', 'user')";
+      *sql << "INSERT INTO account(account_id, domain_id, quorum) "
+              "VALUES ('id@domain', 'domain', 1)";
+      *sql << "ALTER TABLE account ADD COLUMN data JSONB";
+      *sql << "UPDATE account SET data = "
+              "'{\"a@domain\": {\"k1\": \"v1\", \"k2\": \"v2\"}, "
+              "\"b@domain\": {\"k1\": \"v3\"}}'";
+
+      PgConnectionInit::prepareTables(*sql);
+
+      std::vector<std::string> details(3);
+      *sql << "SELECT writer || ' ' || key || ' ' || (value #>> '{}') "
+              "FROM account_detail WHERE account_id = 'id@domain' "
+              "ORDER BY writer, key",
+          soci::into(details);
+      EXPECT_THAT(details,
+                  ::testing::ElementsAre(
+                      "a@domain k1 v1", "a@domain k2 v2", "b@domain k1 v3"));
+
+      int data_columns = -1;
+      *sql << "SELECT count(*) FROM information_schema.columns "
+              "WHERE table_schema = current_schema() "
+              "AND table_name = 'account' AND column_name = 'data'",
+          soci::into(data_columns);
+      EXPECT_EQ(0, data_columns);
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -377,3 +377,41 @@ TEST(StateTest, RemovingTestWhenByTimeHasExpired) {
 
   ASSERT_EQ(2, diff_state.getBatches().size());
 }
+
+/**
+ * @given a state with a partially signed batch
+ * @when a state with a signature delta of the batch is merged into it
+ * @then the valid signature is added to the batch @and the wrong one is
+ * dropped @and the batch is reported as updated
+ */
+TEST(StateTest, SignatureDeltaIsVerifiedAndMerged) {
+  auto time = iroha::time::now();
+  auto batch = addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(1, time)), 0, makeKey());
+  auto state = MstState::empty(mst_state_log_, completer_);
+  state += batch;
+
+  const auto &payload = batch->transactions().at(0)->payload();
+  auto valid_key = makeKey();
+  auto wrong_key = makeKey();
+  auto delta_state = MstState::empty(mst_state_log_, completer_);
+  delta_state.attachSignatures(
+      {batch->reducedHash(),
+       {{{shared_model::crypto::CryptoSigner<>::sign(
+              shared_model::crypto::Blob(payload), valid_key),
+          valid_key.publicKey()},
+         {shared_model::crypto::CryptoSigner<>::sign(
+              shared_model::crypto::Blob("other payload"), wrong_key),
+          wrong_key.publicKey()}}}});
+
+  auto state_update = state += delta_state;
+  ASSERT_EQ(1, state_update.updated_state_->getBatches().size());
+  ASSERT_EQ(0, state_update.completed_state_->getBatches().size());
+  auto signatures =
+      (*state.getBatches().begin())->transactions()[0]->signatures();
+  ASSERT_EQ(2, boost::size(signatures));
+  EXPECT_TRUE(std::any_of(
+      signatures.begin(), signatures.end(), [&valid_key](const auto &s) {
+        return s.publicKey() == valid_key.publicKey();
+      }));
+}
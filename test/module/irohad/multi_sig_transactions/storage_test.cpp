@@ -117,3 +117,33 @@ TEST_F(StorageTest, StorageDoesNotFindNonExistingBatch) {
   auto distinct_batch = makeTestBatch(txBuilder(4, creation_time));
   EXPECT_FALSE(storage->batchInStorage(distinct_batch));
 }
+
+/**
+ * @given storage with three batches @and a peer which has sent one of them
+ * @when the batch gets a new signature @and diff for the peer is made
+ * @then the diff contains the other batches @and only the new signature of
+ * the batch the peer has
+ */
+TEST_F(StorageTest, KnownBatchIsSentAsSignatureDelta) {
+  const shared_model::crypto::PublicKey peer_key("another");
+  auto peer_state = MstState::empty(getTestLogger("MstState"), completer_);
+  peer_state += addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                              0,
+                              makeSignature("1", "pub_key_1"));
+  storage->apply(peer_key, peer_state);
+  storage->updateOwnState(
+      addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                    0,
+                    makeSignature("2", "pub_key_2")));
+
+  auto diff = storage->getDiffState(peer_key, creation_time);
+  EXPECT_EQ(2, diff.getBatches().size());
+  ASSERT_EQ(1, diff.signatureDeltas().size());
+  const auto &delta = diff.signatureDeltas().front();
+  EXPECT_EQ(makeTestBatch(txBuilder(1, creation_time))->reducedHash(),
+            delta.reduced_hash);
+  ASSERT_EQ(1, delta.signatures.size());
+  ASSERT_EQ(1, delta.signatures[0].size());
+  EXPECT_EQ(shared_model::crypto::PublicKey("pub_key_2"),
+            delta.signatures[0][0].public_key);
+}
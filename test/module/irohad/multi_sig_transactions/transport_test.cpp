@@ -71,17 +71,18 @@ class TransportTest : public ::testing::Test {
           return std::unique_ptr<transport::MstTransportGrpc::StubInterface>(
               stub);
         });
-    transport =
-        std::make_shared<MstTransportGrpc>(async_call_,
-                                           tx_factory,
-                                           parser_,
-                                           batch_factory_,
-                                           tx_presence_cache_,
-                                           completer_,
-                                           my_key_.publicKey(),
-                                           getTestLogger("MstState"),
-                                           getTestLogger("MstTransportGrpc"),
-                                           sender_factory_);
+    transport = std::make_shared<MstTransportGrpc>(
+        async_call_,
+        tx_factory,
+        std::make_shared<shared_model::interface::ParallelTransportBuilder>(1),
+        parser_,
+        batch_factory_,
+        tx_presence_cache_,
+        completer_,
+        my_key_.publicKey(),
+        getTestLogger("MstState"),
+        getTestLogger("MstTransportGrpc"),
+        sender_factory_);
     transport->subscribe(mst_notification_transport_);
 
     shared_model::interface::types::PubkeyType pk(
@@ -243,3 +244,44 @@ TEST_F(TransportTest, ReplayAttack) {
   transport->SendState(&context, &proto_state, &response);
   transport->SendState(&context, &proto_state, &response);
 }
+
+/**
+ * @given Initialized transport
+ * AND MstState with a signature delta of a batch
+ * @when Send state via transport
+ * @then received state has the same signature delta and no batches
+ */
+TEST_F(TransportTest, SendAndReceiveSignatureDelta) {
+  auto batch = makeTestBatch(txBuilder(1), txBuilder(2));
+  auto signatory = makeKey();
+  auto signed_blob = shared_model::crypto::CryptoSigner<>::sign(
+      shared_model::crypto::Blob(batch->transactions().at(1)->payload()),
+      signatory);
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state.attachSignatures(
+      {batch->reducedHash(), {{}, {{signed_blob, signatory.publicKey()}}}});
+
+  EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
+      .WillOnce(Invoke([&](::testing::Unused, const iroha::MstState &state) {
+        EXPECT_TRUE(state.getBatches().empty());
+        ASSERT_EQ(1, state.signatureDeltas().size());
+        const auto &delta = state.signatureDeltas().front();
+        EXPECT_EQ(batch->reducedHash(), delta.reduced_hash);
+        ASSERT_EQ(2, delta.signatures.size());
+        EXPECT_TRUE(delta.signatures[0].empty());
+        ASSERT_EQ(1, delta.signatures[1].size());
+        EXPECT_EQ(signed_blob, delta.signatures[1][0].signed_data);
+        EXPECT_EQ(signatory.publicKey(), delta.signatures[1][0].public_key);
+      }));
+
+  ::grpc::ServerContext context;
+  ::iroha::network::transport::MstState request;
+  auto r = std::make_unique<
+      grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
+  EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+  transport->sendState(*peer, state);
+  EXPECT_EQ(0, request.transactions_size());
+  auto response = transport->SendState(&context, &request, nullptr);
+  ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+}
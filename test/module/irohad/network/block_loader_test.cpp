@@ -167,7 +167,8 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
       .WillOnce(Return(top_block.height()));
   EXPECT_CALL(*storage, getBlock(top_block.height()))
       .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(top_block)))));
+          std::shared_ptr<const shared_model::interface::Block>(
+              clone<shared_model::interface::Block>(top_block))))));
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
   wrapper.subscribe([&top_block](auto block) { ASSERT_EQ(*block, top_block); });
@@ -204,7 +205,8 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
 
     EXPECT_CALL(*storage, getBlock(i))
         .WillOnce(Return(ByMove(iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(blk)))));
+            std::shared_ptr<const shared_model::interface::Block>(
+                clone<shared_model::interface::Block>(blk))))));
   }
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
@@ -265,7 +267,8 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getBlock(prev_block->height()))
       .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+          std::shared_ptr<const shared_model::interface::Block>(
+              clone<shared_model::interface::Block>(*prev_block))))));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -291,7 +294,8 @@ TEST_F(BlockLoaderTest, ValidWithEmptyCache) {
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getBlock(prev_block->height()))
       .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+          std::shared_ptr<const shared_model::interface::Block>(
+              clone<shared_model::interface::Block>(*prev_block))))));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batches_mempool.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+#include "ordering/impl/batches_packing_policies.hpp"
+
+using namespace iroha::ordering;
+
+class BatchesMempoolTest : public ::testing::Test {
+ public:
+  const size_t kMaxTransactions = 4;
+  const std::chrono::milliseconds kBatchLifetime{100};
+
+  /**
+   * Create batch of transactions with hashes "<name>_0", "<name>_1", ...
+   * @param name - reduced hash of the batch
+   * @param size - number of transactions in the batch
+   */
+  std::shared_ptr<MockTransactionBatch> makeBatch(const std::string &name,
+                                                  size_t size = 1) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (size_t i = 0; i < size; ++i) {
+      txs.push_back(createMockTransactionWithHash(
+          shared_model::crypto::Hash(name + "_" + std::to_string(i))));
+    }
+    return createMockBatchWithTransactions(txs, name);
+  }
+
+  BatchesMempool mempool{kMaxTransactions, kBatchLifetime};
+  FifoPackingPolicy policy;
+};
+
+/**
+ * @given mempool with a batch
+ * @when the same batch or a batch with the same transaction is inserted
+ * @then insertion fails
+ */
+TEST_F(BatchesMempoolTest, DuplicatesRejected) {
+  auto batch = makeBatch("a");
+  auto same_tx_batch =
+      createMockBatchWithTransactions(batch->transactions(), "b");
+
+  ASSERT_TRUE(mempool.insert(batch, 0));
+  ASSERT_FALSE(mempool.insert(batch, 0));
+  ASSERT_FALSE(mempool.insert(same_tx_batch, 0));
+  ASSERT_EQ(1, mempool.batchesCount());
+}
+
+/**
+ * @given mempool filled up to capacity
+ * @when a new batch is inserted
+ * @then the oldest batches are evicted
+ * AND a batch larger than capacity is not inserted
+ */
+TEST_F(BatchesMempoolTest, OldestEvictedOnOverflow) {
+  ASSERT_TRUE(mempool.insert(makeBatch("a", 2), 0));
+  ASSERT_TRUE(mempool.insert(makeBatch("b", 2), 1));
+  ASSERT_TRUE(mempool.insert(makeBatch("c", 1), 2));
+
+  ASSERT_EQ(2, mempool.batchesCount());
+  ASSERT_EQ(3, mempool.transactionsCount());
+  ASSERT_FALSE(mempool.insert(makeBatch("d", kMaxTransactions + 1), 3));
+
+  auto txs = mempool.takeTransactions(kMaxTransactions, policy);
+  ASSERT_EQ(3, txs.size());
+  ASSERT_EQ(shared_model::crypto::Hash("b_0"), txs.front()->hash());
+}
+
+/**
+ * @given mempool with batches which arrived at different time
+ * @when expired batches are removed
+ * @then only batches older than lifetime are removed
+ */
+TEST_F(BatchesMempoolTest, ExpiredRemoved) {
+  mempool.insert(makeBatch("a"), 0);
+  mempool.insert(makeBatch("b"), 50);
+
+  ASSERT_EQ(0, mempool.removeExpired(kBatchLifetime.count()));
+  ASSERT_EQ(1, mempool.removeExpired(kBatchLifetime.count() + 1));
+  ASSERT_EQ(1, mempool.batchesCount());
+}
+
+/**
+ * @given mempool with batches
+ * @when one of the transactions is committed
+ * @then whole batch with the transaction is removed
+ */
+TEST_F(BatchesMempoolTest, CommittedBatchRemoved) {
+  mempool.insert(makeBatch("a", 2), 0);
+  mempool.insert(makeBatch("b"), 0);
+
+  mempool.remove({shared_model::crypto::Hash("a_1")});
+
+  ASSERT_EQ(1, mempool.batchesCount());
+  ASSERT_EQ(1, mempool.transactionsCount());
+}
+
+/**
+ * @given mempool with batches
+ * @when transactions are taken several times
+ * @then batches taken by the previous call are skipped
+ * AND they are taken again by the next call
+ */
+TEST_F(BatchesMempoolTest, PreviouslyTakenSkipped) {
+  mempool.insert(makeBatch("a"), 0);
+  mempool.insert(makeBatch("b"), 1);
+
+  auto first = mempool.takeTransactions(1, policy);
+  auto second = mempool.takeTransactions(1, policy);
+  auto third = mempool.takeTransactions(2, policy);
+
+  ASSERT_EQ(1, first.size());
+  ASSERT_EQ(shared_model::crypto::Hash("a_0"), first.front()->hash());
+  ASSERT_EQ(1, second.size());
+  ASSERT_EQ(shared_model::crypto::Hash("b_0"), second.front()->hash());
+  ASSERT_EQ(1, third.size());
+  ASSERT_EQ(shared_model::crypto::Hash("a_0"), third.front()->hash());
+  ASSERT_EQ(2, mempool.batchesCount());
+}
+
+/**
+ * @given mempool with batches
+ * @when transactions are requested by hashes
+ * @then only stored transactions are returned
+ */
+TEST_F(BatchesMempoolTest, TransactionsFoundByHashes) {
+  mempool.insert(makeBatch("a", 2), 0);
+
+  auto txs = mempool.getTransactions({shared_model::crypto::Hash("a_1"),
+                                      shared_model::crypto::Hash("b_0")});
+
+  ASSERT_EQ(1, txs.size());
+  ASSERT_EQ(shared_model::crypto::Hash("a_1"), txs.front()->hash());
+}
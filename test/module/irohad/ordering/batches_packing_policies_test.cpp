@@ -0,0 +1,120 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/batches_packing_policies.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ordering;
+
+using ::testing::ElementsAre;
+using ::testing::ReturnRefOfCopy;
+
+class BatchesPackingPoliciesTest : public ::testing::Test {
+ public:
+  /**
+   * Create batch with given number of transactions of the creator
+   * @param name - reduced hash of the batch
+   * @param creator - creator account of all transactions in the batch
+   * @param size - number of transactions in the batch
+   */
+  BatchesPackingPolicy::BatchType makeBatch(const std::string &name,
+                                            const std::string &creator,
+                                            size_t size = 1) {
+    shared_model::interface::types::SharedTxsCollectionType txs;
+    for (size_t i = 0; i < size; ++i) {
+      auto tx = createMockTransactionWithHash(
+          shared_model::crypto::Hash(name + "_" + std::to_string(i)));
+      ON_CALL(*tx, creatorAccountId())
+          .WillByDefault(ReturnRefOfCopy(creator));
+      txs.push_back(tx);
+    }
+    return createMockBatchWithTransactions(txs, name);
+  }
+
+  /**
+   * @return reduced hashes of the batches in the same order
+   */
+  std::vector<std::string> names(
+      const BatchesPackingPolicy::BatchesCollectionType &batches) {
+    std::vector<std::string> result;
+    for (const auto &batch : batches) {
+      result.push_back(
+          shared_model::crypto::toBinaryString(batch->reducedHash()));
+    }
+    return result;
+  }
+};
+
+/**
+ * @given batches where the second one does not fit into the rest of proposal
+ * @when FIFO policy packs them
+ * @then batches are taken in order of arrival up to the one which does not fit
+ */
+TEST_F(BatchesPackingPoliciesTest, FifoStopsOnFirstNotFitting) {
+  BatchesPackingPolicy::BatchesCollectionType candidates{
+      makeBatch("a", "alice@test", 2),
+      makeBatch("b", "alice@test", 3),
+      makeBatch("c", "alice@test", 1)};
+
+  auto packed = FifoPackingPolicy{}.pack(candidates, 4);
+
+  EXPECT_THAT(names(packed), ElementsAre("a"));
+}
+
+/**
+ * @given a lot of batches of one creator followed by a batch of another one
+ * @when round-robin policy packs them into a small proposal
+ * @then batch of the second creator is taken right after the first batch
+ */
+TEST_F(BatchesPackingPoliciesTest, RoundRobinAlternatesCreators) {
+  BatchesPackingPolicy::BatchesCollectionType candidates{
+      makeBatch("a1", "alice@test"),
+      makeBatch("a2", "alice@test"),
+      makeBatch("a3", "alice@test"),
+      makeBatch("b1", "bob@test"),
+      makeBatch("a4", "alice@test")};
+
+  auto packed = RoundRobinPackingPolicy{}.pack(candidates, 3);
+
+  EXPECT_THAT(names(packed), ElementsAre("a1", "b1", "a2"));
+}
+
+/**
+ * @given the oldest batch and batches which fill the rest of proposal only
+ * if the first of them is skipped
+ * @when knapsack policy packs them
+ * @then the oldest batch is taken
+ * AND the rest of proposal is filled completely
+ */
+TEST_F(BatchesPackingPoliciesTest, KnapsackFillsProposal) {
+  BatchesPackingPolicy::BatchesCollectionType candidates{
+      makeBatch("a", "alice@test", 3),
+      makeBatch("b", "alice@test", 2),
+      makeBatch("c", "alice@test", 4),
+      makeBatch("d", "alice@test", 3)};
+
+  auto packed = KnapsackPackingPolicy{}.pack(candidates, 10);
+
+  EXPECT_THAT(names(packed), ElementsAre("a", "c", "d"));
+}
+
+/**
+ * @given batches some of which are beyond knapsack window
+ * @when knapsack policy packs them
+ * @then batches beyond the window fill the rest of proposal
+ */
+TEST_F(BatchesPackingPoliciesTest, KnapsackAddsBatchesBeyondWindow) {
+  BatchesPackingPolicy::BatchesCollectionType candidates{
+      makeBatch("a", "alice@test", 1),
+      makeBatch("b", "alice@test", 1),
+      makeBatch("c", "alice@test", 5),
+      makeBatch("d", "alice@test", 2)};
+
+  auto packed = KnapsackPackingPolicy{1}.pack(candidates, 4);
+
+  EXPECT_THAT(names(packed), ElementsAre("a", "b", "d"));
+}
@@ -20,6 +20,14 @@ namespace iroha {
         MOCK_METHOD1(onRequestProposal,
                      boost::optional<std::shared_ptr<const ProposalType>>(
                          consensus::Round));
+
+        MOCK_METHOD2(onPrefetchProposal,
+                     void(consensus::Round, ProposalCallbackType));
+      };
+
+      struct MockOdOsTransactionsSource : public OdOsTransactionsSource {
+        MOCK_METHOD1(getTransactions,
+                     TransactionsCollectionType(const HashesCollectionType &));
       };
 
     }  // namespace transport
@@ -17,6 +17,7 @@ using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+using ::testing::_;
 using ::testing::ByMove;
 using ::testing::Ref;
 using ::testing::Return;
@@ -131,3 +132,23 @@ TEST_F(OnDemandConnectionManagerTest, onRequestProposalNone) {
 
   ASSERT_FALSE(result);
 }
+
+/**
+ * @given initialized OnDemandConnectionManager
+ * @when proposals for the next reject and commit rounds are prefetched
+ * @then the requests are forwarded to issuers of these rounds
+ */
+TEST_F(OnDemandConnectionManagerTest, onPrefetchProposal) {
+  consensus::Round round{1, 1};
+  auto reject_round = nextRejectRound(round);
+  auto commit_round = nextCommitRound(round);
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kNextRejectIssuer],
+              onPrefetchProposal(reject_round, _))
+      .Times(1);
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kRejectCommitConsumer],
+              onPrefetchProposal(commit_round, _))
+      .Times(1);
+
+  manager->onPrefetchProposal(reject_round, [](auto) {});
+  manager->onPrefetchProposal(commit_round, [](auto) {});
+}
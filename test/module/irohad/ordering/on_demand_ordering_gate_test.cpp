@@ -28,6 +28,7 @@ using ::testing::_;
 using ::testing::AtMost;
 using ::testing::ByMove;
 using ::testing::get;
+using ::testing::Invoke;
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::ReturnRefOfCopy;
@@ -219,6 +220,125 @@ TEST_F(OnDemandOrderingGateTest, BlockEventNoProposal) {
   ASSERT_TRUE(gate_wrapper.validate());
 }
 
+/**
+ * @given initialized ordering gate
+ * @when a round event is received from the PCS
+ * AND a proposal for the next commit round is prefetched
+ * AND the next commit round event is received
+ * @then the prefetched proposal is used without requesting it again
+ */
+TEST_F(OnDemandOrderingGateTest, PrefetchedProposalUsed) {
+  auto mproposal = std::make_unique<MockProposal>();
+  auto proposal = mproposal.get();
+  boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+      oproposal(std::move(mproposal));
+  std::vector<std::shared_ptr<MockTransaction>> txs{
+      std::make_shared<MockTransaction>()};
+  ON_CALL(*txs[0], hash())
+      .WillByDefault(ReturnRefOfCopy(shared_model::crypto::Hash("")));
+  ON_CALL(*proposal, transactions())
+      .WillByDefault(Return(txs | boost::adaptors::indirected));
+  auto next_round = nextCommitRound(round);
+
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::none)));
+  EXPECT_CALL(*notification, onRequestProposal(next_round)).Times(0);
+  EXPECT_CALL(*notification, onPrefetchProposal(_, _))
+      .WillRepeatedly(Invoke(
+          [](consensus::Round, OdOsNotification::ProposalCallbackType cb) {
+            cb(boost::none);
+          }));
+  EXPECT_CALL(*notification, onPrefetchProposal(next_round, _))
+      .WillOnce(Invoke([&oproposal](consensus::Round,
+                                    OdOsNotification::ProposalCallbackType cb) {
+        cb(oproposal);
+      }));
+
+  auto gate_wrapper =
+      make_test_subscriber<CallExact>(ordering_gate->onProposal(), 2);
+  gate_wrapper.subscribe([&](auto val) {
+    if (val.round == next_round) {
+      ASSERT_EQ(proposal, getProposalUnsafe(val).get());
+    } else {
+      ASSERT_FALSE(val.proposal);
+    }
+  });
+
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(round, ledger_state));
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(next_round, ledger_state));
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
+
+/**
+ * @given initialized ordering gate
+ * @when a round event is received from the PCS
+ * AND a proposal for the next commit round is prefetched
+ * AND the round is rejected, so the issuer packs the proposal again
+ * AND the next commit round event is received
+ * @then the prefetched proposal is dropped AND the current one is requested
+ */
+TEST_F(OnDemandOrderingGateTest, PrefetchedProposalDroppedOnReject) {
+  auto makeProposal = [](std::vector<std::shared_ptr<MockTransaction>> &txs,
+                         const std::string &hash) {
+    txs.push_back(std::make_shared<MockTransaction>());
+    ON_CALL(*txs.back(), hash())
+        .WillByDefault(ReturnRefOfCopy(shared_model::crypto::Hash(hash)));
+    auto proposal = std::make_shared<MockProposal>();
+    ON_CALL(*proposal, transactions())
+        .WillByDefault(Return(txs | boost::adaptors::indirected));
+    return proposal;
+  };
+  std::vector<std::shared_ptr<MockTransaction>> prefetched_txs, current_txs;
+  auto prefetched_proposal = makeProposal(prefetched_txs, "prefetched");
+  auto current_proposal = makeProposal(current_txs, "current");
+  auto reject_round = nextRejectRound(round);
+  auto commit_round = nextCommitRound(round);
+
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::none)));
+  EXPECT_CALL(*notification, onRequestProposal(reject_round))
+      .WillOnce(Return(ByMove(boost::none)));
+  EXPECT_CALL(*notification, onRequestProposal(commit_round))
+      .WillOnce(Return(ByMove(
+          boost::make_optional<
+              std::shared_ptr<const OdOsNotification::ProposalType>>(
+              current_proposal))));
+  EXPECT_CALL(*notification, onPrefetchProposal(_, _))
+      .WillRepeatedly(Invoke(
+          [](consensus::Round, OdOsNotification::ProposalCallbackType cb) {
+            cb(boost::none);
+          }));
+  EXPECT_CALL(*notification, onPrefetchProposal(commit_round, _))
+      .WillOnce(Invoke([&prefetched_proposal](
+                           consensus::Round,
+                           OdOsNotification::ProposalCallbackType cb) {
+        cb(std::shared_ptr<const OdOsNotification::ProposalType>(
+            prefetched_proposal));
+      }));
+
+  auto gate_wrapper =
+      make_test_subscriber<CallExact>(ordering_gate->onProposal(), 3);
+  gate_wrapper.subscribe([&](auto val) {
+    if (val.round == commit_round) {
+      ASSERT_EQ(current_proposal.get(), getProposalUnsafe(val).get());
+    } else {
+      ASSERT_FALSE(val.proposal);
+    }
+  });
+
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(round, ledger_state));
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(reject_round, ledger_state));
+  rounds.get_subscriber().on_next(
+      OnDemandOrderingGate::RoundSwitch(commit_round, ledger_state));
+
+  ASSERT_TRUE(gate_wrapper.validate());
+}
+
 /**
  * @given initialized ordering gate
  * @when an empty block round event is received from the PCS
@@ -403,6 +523,7 @@ TEST_F(OnDemandOrderingGateTest, PopEmptyBatchesFromTheCache) {
  * @given initialized ordering gate
  * @when an block round event is received from the PCS
  * @then all batches from that event are removed from the cache
+ * AND from the ordering service
  */
 TEST_F(OnDemandOrderingGateTest, BatchesRemoveFromCache) {
   // prepare hashes for mock batches
@@ -415,6 +536,9 @@ TEST_F(OnDemandOrderingGateTest, BatchesRemoveFromCache) {
 
   EXPECT_CALL(*cache, pop()).Times(1);
   EXPECT_CALL(*cache, remove(UnorderedElementsAre(hash1, hash2))).Times(1);
+  EXPECT_CALL(*ordering_service,
+              onTxsCommitted(UnorderedElementsAre(hash1, hash2)))
+      .Times(1);
 
   auto hashes =
       std::make_shared<ordering::cache::OrderingGateCache::HashesSetType>();
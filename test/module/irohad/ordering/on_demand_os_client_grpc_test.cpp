@@ -13,6 +13,7 @@
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/irohad/ordering/mock_on_demand_os_notification.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "ordering_mock.grpc.pb.h"
 
@@ -169,3 +170,75 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposalNone) {
   ASSERT_EQ(request.round().reject_round(), round.reject_round);
   ASSERT_FALSE(proposal);
 }
+
+/**
+ * @given client with transactions source
+ * @when onRequestProposal is called
+ * AND compact proposal returned
+ * @then proposal is requested in compact form
+ * AND only the transaction missing in the source is requested
+ * AND the proposal is rebuilt from local and received transactions
+ */
+TEST_F(OnDemandOsClientGrpcTest, onRequestCompactProposal) {
+  auto source = std::make_shared<MockOdOsTransactionsSource>();
+  auto ustub = std::make_unique<proto::MockOnDemandOrderingStub>();
+  auto compact_stub = ustub.get();
+  auto compact_client =
+      std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
+                                             async_call,
+                                             proposal_factory,
+                                             [&] { return timepoint; },
+                                             timeout,
+                                             getTestLogger("OdOsClientGrpc"),
+                                             source);
+
+  protocol::Proposal full;
+  full.set_height(3);
+  full.set_created_time(4);
+  auto add_transaction = [&full](const std::string &creator) {
+    auto tx = full.add_transactions();
+    tx->mutable_payload()->mutable_reduced_payload()->set_creator_account_id(
+        creator);
+    return std::make_shared<shared_model::proto::Transaction>(*tx);
+  };
+  auto local_tx = add_transaction("local");
+  auto remote_tx = add_transaction("remote");
+  shared_model::proto::Proposal full_proposal(full);
+
+  proto::ProposalResponse response;
+  auto compact = response.mutable_compact_proposal();
+  compact->set_height(full.height());
+  compact->set_created_time(full.created_time());
+  compact->add_transaction_hashes(
+      shared_model::crypto::toBinaryString(local_tx->hash()));
+  compact->add_transaction_hashes(
+      shared_model::crypto::toBinaryString(remote_tx->hash()));
+  compact->set_proposal_hash(
+      shared_model::crypto::toBinaryString(full_proposal.hash()));
+  proto::ProposalRequest request;
+  EXPECT_CALL(*compact_stub, RequestProposal(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request),
+                      SetArgPointee<2>(response),
+                      Return(grpc::Status::OK)));
+
+  EXPECT_CALL(*source, getTransactions(_))
+      .WillOnce(Return(
+          OdOsTransactionsSource::TransactionsCollectionType{local_tx}));
+
+  proto::TransactionsRequest transactions_request;
+  proto::TransactionsResponse transactions_response;
+  *transactions_response.add_transactions() = remote_tx->getTransport();
+  EXPECT_CALL(*compact_stub, RequestTransactions(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&transactions_request),
+                      SetArgPointee<2>(transactions_response),
+                      Return(grpc::Status::OK)));
+
+  auto proposal = compact_client->onRequestProposal(round);
+
+  ASSERT_TRUE(request.compact());
+  ASSERT_EQ(transactions_request.hashes_size(), 1);
+  ASSERT_EQ(transactions_request.hashes(0),
+            shared_model::crypto::toBinaryString(remote_tx->hash()));
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(proposal.value()->hash(), full_proposal.hash());
+}
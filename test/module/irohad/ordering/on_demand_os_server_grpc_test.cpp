@@ -6,6 +6,7 @@
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 
 #include <gtest/gtest.h>
+#include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/proposal.hpp"
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
@@ -47,12 +48,13 @@ struct OnDemandOsServerGrpcTest : public ::testing::Test {
     auto batch_parser =
         std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
     batch_factory = std::make_shared<MockTransactionBatchFactory>();
-    server =
-        std::make_shared<OnDemandOsServerGrpc>(notification,
-                                               std::move(transaction_factory),
-                                               std::move(batch_parser),
-                                               batch_factory,
-                                               getTestLogger("OdOsServerGrpc"));
+    server = std::make_shared<OnDemandOsServerGrpc>(
+        notification,
+        std::move(transaction_factory),
+        std::make_shared<shared_model::interface::ParallelTransportBuilder>(1),
+        std::move(batch_parser),
+        batch_factory,
+        getTestLogger("OdOsServerGrpc"));
   }
 
   std::shared_ptr<MockOdOsNotification> notification;
@@ -159,3 +161,110 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposalNone) {
 
   ASSERT_FALSE(response.has_proposal());
 }
+
+/**
+ * @given server
+ * @when proposal is requested in compact form
+ * AND proposal returned
+ * @then hashes of its transactions are sent instead of transactions
+ * AND the transactions can be requested afterwards by their hashes
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestCompactProposal) {
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_compact(true);
+  proto::ProposalResponse response;
+  protocol::Proposal proposal;
+  proposal.set_height(3);
+  proposal.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("first");
+  proposal.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("second");
+
+  std::shared_ptr<const shared_model::interface::Proposal> iproposal(
+      std::make_shared<const shared_model::proto::Proposal>(proposal));
+  auto tx_hashes = iproposal->transactions()
+      | boost::adaptors::transformed([](const auto &tx) {
+                     return shared_model::crypto::toBinaryString(tx.hash());
+                   });
+  std::vector<std::string> hashes(tx_hashes.begin(), tx_hashes.end());
+  auto proposal_hash = shared_model::crypto::toBinaryString(iproposal->hash());
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(iproposal))));
+
+  server->RequestProposal(nullptr, &request, &response);
+
+  ASSERT_TRUE(response.has_compact_proposal());
+  ASSERT_EQ(response.compact_proposal().height(), 3);
+  ASSERT_THAT(response.compact_proposal().transaction_hashes(),
+              ::testing::ElementsAreArray(hashes));
+  ASSERT_EQ(response.compact_proposal().proposal_hash(), proposal_hash);
+
+  proto::TransactionsRequest transactions_request;
+  *transactions_request.mutable_round() = request.round();
+  transactions_request.add_hashes(hashes.at(1));
+  proto::TransactionsResponse transactions_response;
+
+  server->RequestTransactions(
+      nullptr, &transactions_request, &transactions_response);
+
+  ASSERT_EQ(transactions_response.transactions_size(), 1);
+  ASSERT_EQ(transactions_response.transactions(0)
+                .payload()
+                .reduced_payload()
+                .creator_account_id(),
+            "second");
+}
+
+/**
+ * @given server
+ * @when transactions are requested for the round without served proposal
+ * @then empty response is returned
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestTransactionsUnknownRound) {
+  proto::TransactionsRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.add_hashes("hash");
+  proto::TransactionsResponse response;
+
+  server->RequestTransactions(nullptr, &request, &response);
+
+  ASSERT_EQ(response.transactions_size(), 0);
+}
+
+/**
+ * @given server
+ * @when proposal is requested ahead of the round
+ * @then it is prefetched from the ordering service
+ * AND the request is not passed as a regular one
+ */
+TEST_F(OnDemandOsServerGrpcTest, PrefetchProposal) {
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_prefetch(true);
+  proto::ProposalResponse response;
+  protocol::Proposal proposal;
+  proposal.set_height(round.block_round);
+
+  std::shared_ptr<const shared_model::interface::Proposal> iproposal(
+      std::make_shared<const shared_model::proto::Proposal>(proposal));
+  EXPECT_CALL(*notification, onRequestProposal(_)).Times(0);
+  EXPECT_CALL(*notification, onPrefetchProposal(round, _))
+      .WillOnce(Invoke(
+          [&iproposal](consensus::Round,
+                       OdOsNotification::ProposalCallbackType callback) {
+            callback(iproposal);
+          }));
+
+  server->RequestProposal(nullptr, &request, &response);
+
+  ASSERT_TRUE(response.has_proposal());
+  ASSERT_EQ(response.proposal().height(), round.block_round);
+}
@@ -18,6 +18,7 @@
 #include "module/irohad/ordering/mock_proposal_creation_strategy.hpp"
 #include "module/shared_model/interface_mocks.hpp"
 #include "module/shared_model/validators/validators.hpp"
+#include "ordering/impl/batches_packing_policies.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
 using namespace iroha;
@@ -76,6 +77,7 @@ class OnDemandOsTest : public ::testing::Test {
         std::move(factory),
         std::move(tx_cache),
         proposal_creation_strategy,
+        std::make_shared<FifoPackingPolicy>(),
         getTestLogger("OdOrderingService"),
         proposal_limit);
   }
@@ -220,6 +222,7 @@ TEST_F(OnDemandOsTest, UseFactoryForProposal) {
       std::move(factory),
       std::move(tx_cache),
       proposal_creation_strategy,
+      std::make_shared<FifoPackingPolicy>(),
       getTestLogger("OdOrderingService"),
       proposal_limit);
 
@@ -342,7 +345,8 @@ TEST_F(OnDemandOsTest, DuplicateTxTest) {
 /**
  * @given initialized on-demand OS with a batch in collection
  * @when two batches sequentially arrives in two reject rounds
- * @then both of them are used for the next proposal
+ * @then the batch from the proposal of the current round is held back
+ * AND it is used again after the current round is rejected
  */
 TEST_F(OnDemandOsTest, RejectCommit) {
   auto now = iroha::time::now();
@@ -358,10 +362,60 @@ TEST_F(OnDemandOsTest, RejectCommit) {
   auto proposal = os->onRequestProposal(
       {initial_round.block_round, initial_round.reject_round + 3});
 
-  ASSERT_EQ(2, boost::size((*proposal)->transactions()));
+  ASSERT_EQ(1, boost::size((*proposal)->transactions()));
+  ASSERT_EQ(*txs2.front()->transactions().front(),
+            *(*proposal)->transactions().begin());
 
   proposal = os->onRequestProposal(commit_round);
-  ASSERT_EQ(2, boost::size((*proposal)->transactions()));
+  ASSERT_EQ(1, boost::size((*proposal)->transactions()));
+
+  os->onCollaborationOutcome(
+      {initial_round.block_round, initial_round.reject_round + 3});
+  proposal = os->onRequestProposal(
+      {initial_round.block_round, initial_round.reject_round + 4});
+
+  ASSERT_EQ(1, boost::size((*proposal)->transactions()));
+  ASSERT_EQ(*txs1.front()->transactions().front(),
+            *(*proposal)->transactions().begin());
+}
+
+/**
+ * @given initialized on-demand OS with more transactions than fit into one
+ * proposal
+ * @when commit rounds pass
+ * @then transactions which did not fit are kept for next proposals
+ */
+TEST_F(OnDemandOsTest, PendingBatchesKeptAcrossRounds) {
+  generateTransactionsAndInsert({0, transaction_limit * 2});
+
+  os->onCollaborationOutcome(initial_round);
+  auto proposal = os->onRequestProposal(commit_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(transaction_limit, boost::size((*proposal)->transactions()));
+
+  os->onCollaborationOutcome(commit_round);
+  auto next_proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(next_proposal);
+  ASSERT_EQ(transaction_limit, boost::size((*next_proposal)->transactions()));
+  for (const auto &tx : (*next_proposal)->transactions()) {
+    const auto &txs = (*proposal)->transactions();
+    EXPECT_TRUE(std::find(txs.begin(), txs.end(), tx) == txs.end());
+  }
+}
+
+/**
+ * @given initialized on-demand OS with a batch inside
+ * @when the batch is committed
+ * @then the batch is not used for next proposals
+ */
+TEST_F(OnDemandOsTest, CommittedBatchRemoved) {
+  auto batches = generateTransactions({1, 2});
+  os->onBatches(batches);
+
+  os->onTxsCommitted({batches.front()->transactions().front()->hash()});
+  os->onCollaborationOutcome(commit_round);
+
+  ASSERT_FALSE(os->onRequestProposal(target_round));
 }
 
 /**
@@ -379,3 +433,24 @@ TEST_F(OnDemandOsTest, FailOnCreationStrategy) {
 
   ASSERT_FALSE(os->onRequestProposal(target_round));
 }
+
+/**
+ * @given initialized on-demand OS with a proposal for the target round
+ * @when the proposal is prefetched
+ * @then it is passed to the callback
+ * AND creation strategy is not notified about the request
+ */
+TEST_F(OnDemandOsTest, PrefetchProposal) {
+  generateTransactionsAndInsert({1, 2});
+  os->onCollaborationOutcome(commit_round);
+
+  EXPECT_CALL(*proposal_creation_strategy, onProposalRequest(_)).Times(0);
+  boost::optional<std::shared_ptr<const OnDemandOrderingService::ProposalType>>
+      prefetched;
+  os->onPrefetchProposal(target_round, [&prefetched](auto proposal) {
+    prefetched = std::move(proposal);
+  });
+
+  ASSERT_TRUE(prefetched);
+  ASSERT_EQ(1, boost::size((*prefetched)->transactions()));
+}
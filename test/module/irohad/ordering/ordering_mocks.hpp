@@ -42,7 +42,15 @@ namespace iroha {
                    boost::optional<std::shared_ptr<const ProposalType>>(
                        consensus::Round));
 
+      MOCK_METHOD2(onPrefetchProposal,
+                   void(consensus::Round, ProposalCallbackType));
+
       MOCK_METHOD1(onCollaborationOutcome, void(consensus::Round));
+
+      MOCK_METHOD1(onTxsCommitted, void(const HashesSetType &));
+
+      MOCK_METHOD1(getTransactions,
+                   TransactionsCollectionType(const HashesCollectionType &));
     };
 
   }  // namespace ordering
@@ -0,0 +1,134 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/impl/parallel_block_downloader.hpp"
+
+#include <thread>
+
+#include <gmock/gmock.h>
+#include "framework/test_logger.hpp"
+#include "module/irohad/network/network_mocks.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::network;
+using namespace iroha::synchronizer;
+using namespace std::chrono_literals;
+
+using shared_model::interface::types::HeightType;
+using ::testing::_;
+using ::testing::AtLeast;
+using ::testing::Invoke;
+using ::testing::Return;
+
+using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+using Blocks = std::vector<BlockPtr>;
+
+static const HeightType kBlocks = 10;
+
+class ParallelBlockDownloaderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (HeightType i = 1; i <= kBlocks; ++i) {
+      blocks_.push_back(std::make_shared<MockBlock>());
+    }
+    for (char c : {'a', 'b', 'c'}) {
+      peers_.emplace_back(std::string(32, c));
+    }
+  }
+
+  /// @return blocks of the range after a short delay
+  boost::optional<Blocks> range(HeightType first, HeightType last) {
+    std::this_thread::sleep_for(10ms);
+    return Blocks(blocks_.begin() + first - 1, blocks_.begin() + last);
+  }
+
+  /// @return all blocks emitted by the downloader
+  Blocks download(HeightType first, HeightType last) {
+    Blocks received;
+    downloader_.download(first, last, peers_)
+        .as_blocking()
+        .subscribe([&received](auto block) { received.push_back(block); });
+    return received;
+  }
+
+ protected:
+  std::shared_ptr<MockBlockLoader> block_loader_ =
+      std::make_shared<MockBlockLoader>();
+  ParallelBlockDownloader downloader_{
+      block_loader_, getTestLogger("ParallelBlockDownloader"), 2, 4};
+  Blocks blocks_;
+  std::vector<shared_model::interface::types::PubkeyType> peers_;
+};
+
+/**
+ * @given three peers and a range of five windows
+ * @when the range is downloaded
+ * @then every peer retrieves some windows
+ * AND blocks are emitted in height order
+ */
+TEST_F(ParallelBlockDownloaderTest, BlocksFromSeveralPeersAreEmittedInOrder) {
+  for (const auto &peer : peers_) {
+    EXPECT_CALL(*block_loader_, retrieveBlockRange(peer, _, _))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Invoke([this](const auto &, auto first, auto last) {
+          return range(first, last);
+        }));
+  }
+
+  EXPECT_EQ(blocks_, download(1, kBlocks));
+}
+
+/**
+ * @given three peers, one of which fails to provide blocks
+ * @when the range is downloaded
+ * @then the failed window is retrieved from other peers
+ * AND the failed peer is asked only once
+ */
+TEST_F(ParallelBlockDownloaderTest, FailedWindowIsRetriedOnAnotherPeer) {
+  EXPECT_CALL(*block_loader_, retrieveBlockRange(peers_[0], _, _))
+      .WillOnce(Return(boost::none));
+  for (const auto &peer : {peers_[1], peers_[2]}) {
+    EXPECT_CALL(*block_loader_, retrieveBlockRange(peer, _, _))
+        .WillRepeatedly(Invoke([this](const auto &, auto first, auto last) {
+          return range(first, last);
+        }));
+  }
+
+  EXPECT_EQ(blocks_, download(1, kBlocks));
+}
+
+/**
+ * @given three peers and a range of a single window, which the first peer
+ * fails to provide
+ * @when the range is downloaded
+ * @then the window is retrieved from a peer which was not started
+ */
+TEST_F(ParallelBlockDownloaderTest, UnusedPeerReplacesFailedOne) {
+  EXPECT_CALL(*block_loader_, retrieveBlockRange(peers_[0], _, _))
+      .WillOnce(Return(boost::none));
+  EXPECT_CALL(*block_loader_, retrieveBlockRange(peers_[1], 1, 2))
+      .WillOnce(Invoke([this](const auto &, auto first, auto last) {
+        return range(first, last);
+      }));
+  EXPECT_CALL(*block_loader_, retrieveBlockRange(peers_[2], _, _)).Times(0);
+
+  Blocks first_window(blocks_.begin(), blocks_.begin() + 2);
+  EXPECT_EQ(first_window, download(1, 2));
+}
+
+/**
+ * @given three peers, none of which provides the second window
+ * @when the range is downloaded
+ * @then only the blocks of the first window are emitted
+ */
+TEST_F(ParallelBlockDownloaderTest, DownloadStopsWhenNoPeerHasWindow) {
+  EXPECT_CALL(*block_loader_, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(Invoke([this](const auto &, auto first, auto last) {
+        return first == 3 ? boost::none : range(first, last);
+      }));
+
+  Blocks first_window(blocks_.begin(), blocks_.begin() + 2);
+  EXPECT_EQ(first_window, download(1, kBlocks));
+}
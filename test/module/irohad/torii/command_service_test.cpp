@@ -81,6 +81,9 @@ TEST_F(CommandServiceTest, getStatusStreamWithAbsentHash) {
   EXPECT_CALL(*status_bus_, statuses())
       .WillRepeatedly(Return(
           rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+  EXPECT_CALL(*status_bus_, statuses(hash))
+      .WillOnce(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
 
   initCommandService();
   auto wrapper = framework::test_subscriber::make_test_subscriber<
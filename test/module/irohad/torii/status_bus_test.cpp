@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/status_bus_impl.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_tx_status_factory.hpp"
+
+using iroha::torii::StatusBus;
+using iroha::torii::StatusBusImpl;
+
+class StatusBusTest : public ::testing::Test {
+ public:
+  /// @return hashes of the statuses published to the subscriber of given hash
+  std::shared_ptr<std::vector<shared_model::crypto::Hash>> collect(
+      const shared_model::crypto::Hash &hash,
+      rxcpp::composite_subscription subscription =
+          rxcpp::composite_subscription()) {
+    auto received = std::make_shared<std::vector<shared_model::crypto::Hash>>();
+    status_bus_.statuses(hash).subscribe(
+        subscription, [received](const StatusBus::Objects &status) {
+          received->push_back(status->transactionHash());
+        });
+    return received;
+  }
+
+ protected:
+  StatusBusImpl status_bus_{
+      rxcpp::observe_on_one_worker(rxcpp::schedulers::make_current_thread())};
+  shared_model::proto::ProtoTxStatusFactory status_factory_;
+  shared_model::crypto::Hash hash1_{"1"}, hash2_{"2"};
+};
+
+/**
+ * @given subscribers of statuses of two transactions
+ * @when statuses of both transactions are published
+ * @then each subscriber receives only the statuses of its transaction
+ */
+TEST_F(StatusBusTest, StatusesAreDispatchedByHash) {
+  auto received1 = collect(hash1_);
+  auto received2 = collect(hash2_);
+
+  status_bus_.publish(status_factory_.makeNotReceived(hash1_, {}));
+  status_bus_.publish(status_factory_.makeNotReceived(hash2_, {}));
+  status_bus_.publish(status_factory_.makeCommitted(hash1_, {}));
+
+  EXPECT_EQ(*received1,
+            std::vector<shared_model::crypto::Hash>({hash1_, hash1_}));
+  EXPECT_EQ(*received2, std::vector<shared_model::crypto::Hash>({hash2_}));
+}
+
+/**
+ * @given a subscriber of statuses of a transaction
+ * @when it unsubscribes and a status of the transaction is published
+ * @then the subscriber does not receive the status
+ * AND subscribers of all statuses still receive it
+ */
+TEST_F(StatusBusTest, UnsubscribedSubscriberReceivesNothing) {
+  rxcpp::composite_subscription subscription;
+  auto received = collect(hash1_, subscription);
+  size_t all_received = 0;
+  status_bus_.statuses().subscribe(
+      [&all_received](const auto &) { ++all_received; });
+
+  subscription.unsubscribe();
+  status_bus_.publish(status_factory_.makeNotReceived(hash1_, {}));
+
+  EXPECT_TRUE(received->empty());
+  EXPECT_EQ(1, all_received);
+}
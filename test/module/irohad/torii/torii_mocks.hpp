@@ -25,6 +25,9 @@ namespace iroha {
      public:
       MOCK_METHOD1(publish, void(StatusBus::Objects));
       MOCK_METHOD0(statuses, rxcpp::observable<StatusBus::Objects>());
+      MOCK_METHOD1(statuses,
+                   rxcpp::observable<StatusBus::Objects>(
+                       const shared_model::crypto::Hash &));
     };
 
     class MockCommandService : public iroha::torii::CommandService {
@@ -18,14 +18,18 @@
 #include "endpoint.pb.h"
 #include "endpoint_mock.grpc.pb.h"
 #include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "main/server_runner.hpp"
 #include "module/irohad/network/network_mocks.hpp"
 #include "module/irohad/torii/torii_mocks.hpp"
 #include "module/shared_model/interface/mock_transaction_batch_factory.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "module/vendor/grpc_mocks.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+#include "torii/command_client.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "validators/protobuf/proto_transaction_validator.hpp"
 
@@ -86,6 +90,7 @@ class CommandServiceTransportGrpcTest : public testing::Test {
         status_bus,
         status_factory,
         transaction_factory,
+        std::make_shared<shared_model::interface::ParallelTransportBuilder>(1),
         batch_parser,
         batch_factory,
         rxcpp::observable<>::iterate(gate_objects),
@@ -294,3 +299,73 @@ TEST_F(CommandServiceTransportGrpcTest, StatusStreamOnNotReceived) {
                           &response_writer))
                   .ok());
 }
+
+/**
+ * @given torii service and status streams of two transactions
+ * @when calling ListStatusStream for both transactions
+ * @then ServerWriter writes statuses of both transactions
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListStatusStream) {
+  grpc::ServerContext context;
+  iroha::protocol::TxStatusRequestList request;
+  iroha::MockServerWriter<iroha::protocol::ToriiResponse> response_writer;
+
+  for (const auto &hex : {std::string(kHashLength * 2, '1'),
+                          std::string(kHashLength * 2, '2')}) {
+    auto hash = shared_model::crypto::Hash::fromHexString(hex);
+    request.add_requests()->set_tx_hash(hex);
+    std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+        responses{status_factory->makeCommitted(hash, {})};
+    EXPECT_CALL(*command_service, getStatusStream(hash))
+        .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+    EXPECT_CALL(response_writer,
+                Write(Property(&iroha::protocol::ToriiResponse::tx_hash,
+                               StrEq(hash.hex())),
+                      _))
+        .WillOnce(Return(true));
+  }
+
+  ASSERT_TRUE(transport_grpc
+                  ->ListStatusStream(
+                      &context,
+                      &request,
+                      reinterpret_cast<
+                          grpc::ServerWriter<iroha::protocol::ToriiResponse> *>(
+                          &response_writer))
+                  .ok());
+}
+
+/**
+ * @given torii service which serves status streams asynchronously
+ * @when a client calls StatusStream over the network
+ * @then the client receives the status of the transaction
+ * AND the stream is finished after the final status
+ */
+TEST_F(CommandServiceTransportGrpcTest, AsyncStatusStream) {
+  auto hash = shared_model::crypto::Hash::fromHexString(
+      std::string(kHashLength * 2, '1'));
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      responses{status_factory->makeCommitted(hash, {})};
+  EXPECT_CALL(*command_service, getStatusStream(hash))
+      .WillOnce(Return(rxcpp::observable<>::iterate(responses)));
+
+  ServerRunner runner("127.0.0.1:0", getTestLogger("ServerRunner"));
+  int port = 0;
+  runner.append(transport_grpc, transport_grpc->serveStatusStreamsAsync())
+      .run()
+      .match([&port](auto result) { port = result.value; },
+             [](const auto &error) { FAIL() << error.error; });
+  runner.waitForServersReady();
+
+  ::torii::CommandSyncClient client(
+      iroha::network::createClient<iroha::protocol::CommandService_v1>(
+          "127.0.0.1:" + std::to_string(port)),
+      getTestLogger("CommandSyncClient"));
+  iroha::protocol::TxStatusRequest request;
+  request.set_tx_hash(hash.hex());
+  std::vector<iroha::protocol::ToriiResponse> received;
+  client.StatusStream(request, received);
+
+  ASSERT_EQ(1, received.size());
+  EXPECT_EQ(hash.hex(), received[0].tx_hash());
+}
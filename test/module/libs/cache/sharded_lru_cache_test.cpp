@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cache/sharded_lru_cache.hpp"
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::cache;
+
+/**
+ * @given cache with a single shard of three items
+ * @when four items are inserted
+ * @then the first inserted item is evicted
+ * AND the others are kept
+ */
+TEST(ShardedLruCacheTest, LeastRecentlyUsedItemIsEvicted) {
+  ShardedLruCache<int, std::string> cache(3, 1);
+  for (int i = 0; i < 4; ++i) {
+    cache.addItem(i, std::to_string(i));
+  }
+
+  ASSERT_EQ(cache.getCacheItemCount(), 3);
+  ASSERT_FALSE(cache.findItem(0));
+  for (int i = 1; i < 4; ++i) {
+    auto item = cache.findItem(i);
+    ASSERT_TRUE(item);
+    ASSERT_EQ(*item, std::to_string(i));
+  }
+}
+
+/**
+ * @given cache with a single full shard
+ * @when the oldest item is found and a new item is inserted
+ * @then the found item is kept
+ * AND the second oldest item is evicted
+ */
+TEST(ShardedLruCacheTest, FoundItemBecomesRecentlyUsed) {
+  ShardedLruCache<int, std::string> cache(3, 1);
+  for (int i = 0; i < 3; ++i) {
+    cache.addItem(i, std::to_string(i));
+  }
+
+  ASSERT_TRUE(cache.findItem(0));
+  cache.addItem(3, "3");
+
+  ASSERT_TRUE(cache.findItem(0));
+  ASSERT_FALSE(cache.findItem(1));
+}
+
+/**
+ * @given cache with an item
+ * @when an item with the same key is inserted
+ * @then amount of items is not changed
+ * AND the value is replaced
+ */
+TEST(ShardedLruCacheTest, InsertSameKeyReplacesValue) {
+  ShardedLruCache<int, std::string> cache;
+  cache.addItem(1, "old");
+  cache.addItem(1, "new");
+
+  ASSERT_EQ(cache.getCacheItemCount(), 1);
+  auto item = cache.findItem(1);
+  ASSERT_TRUE(item);
+  ASSERT_EQ(*item, "new");
+}
+
+/**
+ * @given full sharded cache
+ * @when many more items are inserted
+ * @then amount of items never exceeds the capacity
+ * AND the cache stays full, without dropping items in bursts
+ */
+TEST(ShardedLruCacheTest, CacheStaysFullOnOverflow) {
+  ShardedLruCache<int, int> cache(64, 4);
+  int key = 0;
+  while (cache.getCacheItemCount() < cache.getCapacity()) {
+    cache.addItem(key, key);
+    ++key;
+  }
+
+  for (int i = 0; i < 1000; ++i, ++key) {
+    cache.addItem(key, key);
+    ASSERT_EQ(cache.getCacheItemCount(), cache.getCapacity());
+  }
+}
+
+/**
+ * @given cache
+ * @when several threads insert and find items at once
+ * @then every thread finds the items it has just inserted
+ */
+TEST(ShardedLruCacheTest, ConcurrentAccess) {
+  const int kThreads = 4;
+  const int kItems = 1000;
+  ShardedLruCache<int, int> cache(kThreads * kItems);
+
+  std::vector<std::thread> threads;
+  std::vector<int> found(kThreads, 0);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&cache, &found, t, kItems] {
+      for (int i = t * kItems; i < (t + 1) * kItems; ++i) {
+        cache.addItem(i, i);
+        if (cache.findItem(i) == i) {
+          ++found[t];
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < kThreads; ++t) {
+    ASSERT_EQ(found[t], kItems);
+  }
+}
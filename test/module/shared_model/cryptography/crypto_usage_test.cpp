@@ -89,6 +89,47 @@ TEST_F(CryptoUsageTest, RawSignAndVerifyTest) {
   ASSERT_TRUE(verified);
 }
 
+/**
+ * @given batch of correct signatures, some of them made over the same data
+ * @when verify the batch
+ * @then no entry is reported as failed
+ */
+TEST_F(CryptoUsageTest, VerifyBatchOfCorrectSignatures) {
+  auto other_keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  Blob other_data("other raw data for signing");
+  auto first = DefaultCryptoAlgorithmType::sign(data, keypair);
+  auto second = DefaultCryptoAlgorithmType::sign(data, other_keypair);
+  auto third = DefaultCryptoAlgorithmType::sign(other_data, keypair);
+
+  VerificationBatch batch;
+  batch.emplace_back(first, data, keypair.publicKey());
+  batch.emplace_back(second, data, other_keypair.publicKey());
+  batch.emplace_back(third, other_data, keypair.publicKey());
+
+  ASSERT_TRUE(CryptoVerifier<>::verifyBatch(batch).empty());
+}
+
+/**
+ * @given batch with a signature made over other data and a signature checked
+ * against a wrong public key
+ * @when verify the batch
+ * @then exactly those two entries are reported as failed
+ */
+TEST_F(CryptoUsageTest, VerifyBatchIsolatesWrongSignatures) {
+  auto other_keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  auto correct = DefaultCryptoAlgorithmType::sign(data, keypair);
+  auto wrong_data = DefaultCryptoAlgorithmType::sign(Blob("wrong"), keypair);
+
+  VerificationBatch batch;
+  batch.emplace_back(correct, data, keypair.publicKey());
+  batch.emplace_back(wrong_data, data, keypair.publicKey());
+  batch.emplace_back(correct, data, keypair.publicKey());
+  batch.emplace_back(correct, data, other_keypair.publicKey());
+
+  ASSERT_EQ(CryptoVerifier<>::verifyBatch(batch),
+            (VerificationFailures{1, 3}));
+}
+
 /**
  * @given unsigned block
  * @when verify block
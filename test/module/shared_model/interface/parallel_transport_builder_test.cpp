@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/iroha_internal/parallel_transport_builder.hpp"
+
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::interface;
+
+namespace {
+  /**
+   * Factory which builds even numbers and rejects odd ones
+   */
+  class EvenNumberFactory : public AbstractTransportFactory<int, int> {
+   public:
+    iroha::expected::Result<std::unique_ptr<int>, Error> build(
+        int transport) const override {
+      if (transport % 2 != 0) {
+        return iroha::expected::makeError(
+            Error{{}, "odd number " + std::to_string(transport)});
+      }
+      return iroha::expected::makeValue(std::make_unique<int>(transport));
+    }
+  };
+}  // namespace
+
+class ParallelTransportBuilderTest : public ::testing::Test {
+ public:
+  EvenNumberFactory factory;
+  ParallelTransportBuilder builder{4};
+};
+
+/**
+ * @given collection of transport objects, some of which are invalid
+ * @when the collection is built in parallel
+ * @then results are returned in the order of the collection
+ * @and errors are reported in place of invalid objects
+ */
+TEST_F(ParallelTransportBuilderTest, KeepsOrderOfCollection) {
+  std::vector<int> transports(1000);
+  std::iota(transports.begin(), transports.end(), 0);
+
+  auto results = builder.build(factory, transports);
+
+  ASSERT_EQ(results.size(), transports.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    results[i].match(
+        [&](const auto &value) {
+          EXPECT_EQ(i % 2, 0u);
+          EXPECT_EQ(*value.value, transports[i]);
+        },
+        [&](const auto &error) {
+          EXPECT_EQ(i % 2, 1u);
+          EXPECT_EQ(error.error.error,
+                    "odd number " + std::to_string(transports[i]));
+        });
+  }
+}
+
+/**
+ * @given empty collection and collection with a single object
+ * @when the collections are built
+ * @then results have the sizes of the collections
+ */
+TEST_F(ParallelTransportBuilderTest, SmallCollections) {
+  EXPECT_TRUE(builder.build(factory, std::vector<int>{}).empty());
+  EXPECT_EQ(builder.build(factory, std::vector<int>{2}).size(), 1u);
+}